@@ -0,0 +1,210 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: arithmeticBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Compares arithmetic datasets (values computed, nothing stored) with the
+// same values stored in a vector:
+//   1. constructing a numMixer over 1-100, the default dataset, in ns and
+// heap allocations and bytes per numMixer;
+//   2. pinging 4096 values (MIX, EVEN, ODD) over 1 to n, in ns per value, as
+// n grows past the caches: stored values cost a memory load per draw,
+// arithmetic ones a multiply-add.
+
+// ASSUMPTIONS:
+// * Usage: arithmeticBench [max size]. Sizes go from 10^2 to the max size
+// (default 10^8, 400 MB stored).
+// * Heap use is counted by replacing the global operator new and new[] for
+// this program, with the matching scalar, array and sized deletes.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <cstdlib>  // malloc, free
+#include <atomic>  // atomic
+#include <memory>  // make_shared
+#include <new>  // bad_alloc
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+#include "benchUtil.h"
+
+
+std::atomic<std::size_t> allocations(0);
+// The number of heap allocations so far.
+
+std::atomic<std::size_t> allocatedBytes(0);
+// The number of bytes they requested.
+
+
+void* operator new(std::size_t bytes)
+{
+	++allocations;
+	allocatedBytes += bytes;
+	void* block = std::malloc(bytes > 0 ? bytes : 1);
+	if (!block) {
+		throw std::bad_alloc();
+	}
+	return block;
+}
+// DESCRIPTION:
+// * Counts every allocation of the program, then allocates as usual.
+
+
+void operator delete(void* block) noexcept
+{
+	std::free(block);
+}
+
+
+void operator delete(void* block, std::size_t) noexcept
+{
+	std::free(block);
+}
+
+
+void* operator new[](std::size_t bytes)
+{
+	return operator new(bytes);
+}
+// DESCRIPTION:
+// * Counts array allocations through the counting operator new.
+
+
+void operator delete[](void* block) noexcept
+{
+	std::free(block);
+}
+
+
+void operator delete[](void* block, std::size_t) noexcept
+{
+	std::free(block);
+}
+
+
+void reportConstruction();
+
+void reportPings(std::size_t size);
+
+double pingNanoseconds(basicNumDatasetHandle<int> dataset, const char* state);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t maxSize = argumentOr(argc, argv, 1, 100000000);
+
+	reportConstruction();
+
+	std::printf("\n%10s %6s %12s %12s\n", "size", "state", "computed ns",
+	            "stored ns");
+	for (std::size_t size = 100; size <= maxSize; size *= 100) {
+		reportPings(size);
+	}
+	return 0;
+}
+
+
+void reportConstruction()
+{
+	const std::size_t OBJECTS = 1000;
+	std::size_t before = allocations;
+	std::size_t beforeBytes = allocatedBytes;
+	const double computed = nanosecondsPer([&] {
+		unlimitedNumMixer<int> numMixerObj;
+		keep(numMixerObj);
+	});
+	std::vector<unlimitedNumMixer<int>*> kept;
+	for (std::size_t i = 0; i < OBJECTS; ++i) {
+		kept.push_back(new unlimitedNumMixer<int>());
+	}
+	const double computedAllocations =
+		(allocations - before) / static_cast<double>(OBJECTS);
+	const double computedBytes =
+		(allocatedBytes - beforeBytes) / static_cast<double>(OBJECTS);
+	for (std::size_t i = 0; i < OBJECTS; ++i) {
+		delete kept[i];
+	}
+	kept.clear();
+
+	const double stored = nanosecondsPer([&] {
+		std::vector<int> values(100);
+		for (int i = 0; i < 100; ++i) {
+			values[i] = i + 1;
+		}
+		unlimitedNumMixer<int> numMixerObj(std::move(values));
+		keep(numMixerObj);
+	});
+	before = allocations;
+	beforeBytes = allocatedBytes;
+	for (std::size_t i = 0; i < OBJECTS; ++i) {
+		std::vector<int> values(100);
+		for (int v = 0; v < 100; ++v) {
+			values[v] = v + 1;
+		}
+		kept.push_back(new unlimitedNumMixer<int>(std::move(values)));
+	}
+	const double storedAllocations =
+		(allocations - before) / static_cast<double>(OBJECTS);
+	const double storedBytes =
+		(allocatedBytes - beforeBytes) / static_cast<double>(OBJECTS);
+	for (std::size_t i = 0; i < OBJECTS; ++i) {
+		delete kept[i];
+	}
+
+	std::printf("%-10s %14s %14s %14s\n", "dataset", "construct ns",
+	            "allocations", "heap bytes");
+	std::printf("%-10s %14.1f %14.2f %14.1f\n", "computed", computed,
+	            computedAllocations, computedBytes);
+	std::printf("%-10s %14.1f %14.2f %14.1f\n", "stored", stored,
+	            storedAllocations, storedBytes);
+}
+// DESCRIPTION:
+// * Prints the time, heap allocations and heap bytes per numMixer over
+// 1-100, computed (the default constructor) and stored. Allocations and
+// bytes include the numMixer object itself.
+
+
+void reportPings(std::size_t size)
+{
+	const char* STATES[] = {"MIX", "EVEN", "ODD"};
+	std::vector<int> values(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		values[i] = static_cast<int>(i + 1);
+	}
+	const basicNumDatasetHandle<int> stored =
+		std::make_shared<const basicNumDataset<int> >(std::move(values));
+	const basicNumDatasetHandle<int> computed =
+		std::make_shared<const basicNumDataset<int> >(
+			basicNumDataset<int>::arithmetic(1, size));
+
+	for (const char* state : STATES) {
+		std::printf("%10zu %6s %12.2f %12.2f\n", size, state,
+		            pingNanoseconds(computed, state),
+		            pingNanoseconds(stored, state));
+	}
+}
+// DESCRIPTION:
+// * Prints the ns per value of pings over 1 to "size", computed and stored,
+// for each controller state.
+
+
+double pingNanoseconds(basicNumDatasetHandle<int> dataset, const char* state)
+{
+	const std::size_t PING_SIZE = 4096;
+	unlimitedNumMixer<int> numMixerObj(dataset);
+	numMixerObj.setControllerState(state);
+	std::vector<int> out(PING_SIZE);
+	return nanosecondsPer([&] {
+		numMixerObj.ping(out.data(), PING_SIZE);
+		keep(out);
+	}, PING_SIZE);
+}
+// DESCRIPTION:
+// * Returns the mean ns per value of 4096 value pings over "dataset" in
+// "state".
\ No newline at end of file
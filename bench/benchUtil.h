@@ -0,0 +1,140 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: benchUtil.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Header-only helpers shared by the benchmarks in bench/: a wall clock,
+// a barrier that keeps results alive, command line sizes, an engine wrapper
+// counting its outputs and a numMixer that never runs out of pings.
+
+// ASSUMPTIONS:
+// * Each benchmark is its own program (see compileproject.ps1), built with
+// optimizations against the library objects and run by hand. Results are
+// printed as aligned columns on stdout.
+// * Benchmarks repeat an operation until about BENCH_SECONDS have passed and
+// report the mean, so short operations are not dominated by the clock.
+
+
+#ifndef benchUtil_INCLUDED
+#define benchUtil_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdlib>  // strtoull
+#include <chrono>  // steady_clock, duration
+#include <random>  // mt19937
+
+
+#include "../include/numMixer.h"
+
+
+const double BENCH_SECONDS = 0.25;
+// How long each measurement repeats its operation.
+
+
+inline double secondsSince(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start).count();
+}
+// DESCRIPTION:
+// * Returns the seconds elapsed since "start".
+
+
+template <class T>
+inline void keep(const T& value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+// DESCRIPTION:
+// * Forces "value" to be computed and stored, so the compiler cannot drop the
+// work being measured.
+
+
+template <class Operation>
+double nanosecondsPer(Operation operation, std::size_t batch = 1)
+{
+	std::size_t runs = 0;
+	std::size_t calls = 1;
+	const std::chrono::steady_clock::time_point start =
+		std::chrono::steady_clock::now();
+	double elapsed = 0;
+	do {
+		for (std::size_t i = 0; i < calls; ++i) {
+			operation();
+		}
+		runs += calls * batch;
+		calls *= 2;
+		elapsed = secondsSince(start);
+	} while (elapsed < BENCH_SECONDS);
+	return elapsed * 1e9 / runs;
+}
+// DESCRIPTION:
+// * Calls "operation" until BENCH_SECONDS have passed and returns the mean
+// nanoseconds per item, counting "batch" items per call.
+// * The clock is read after 1, 2, 4, ... calls, so reading it costs nothing
+// measurable even for operations of a few nanoseconds.
+
+
+inline std::size_t argumentOr(int argc, char** argv, int i,
+                              std::size_t fallback)
+{
+	return (i < argc) ? std::strtoull(argv[i], nullptr, 10) : fallback;
+}
+// DESCRIPTION:
+// * Returns command line argument "i" as a number, or "fallback" if it was
+// not given.
+
+
+template <class Engine>
+class countingEngine
+{
+	public:
+		typedef typename Engine::result_type result_type;
+
+		static constexpr result_type min() { return Engine::min(); }
+		static constexpr result_type max() { return Engine::max(); }
+
+		result_type operator()();
+		// DESCRIPTION:
+		// * Returns the next output of the wrapped engine, counting the call.
+
+		Engine engine;
+		// The wrapped engine.
+
+		std::size_t calls = 0;
+		// The number of outputs drawn so far.
+};
+
+
+template <class Engine>
+inline typename countingEngine<Engine>::result_type
+countingEngine<Engine>::operator()()
+{
+	++calls;
+	return engine();
+}
+
+
+template <class T, class Engine = std::mt19937>
+class unlimitedNumMixer final : public basicNumMixer<T, Engine>
+{
+	public:
+		using basicNumMixer<T, Engine>::basicNumMixer;
+
+		bool isActive() const override;
+		// DESCRIPTION:
+		// * Always true: benchmarks ping far more than 10-20 times.
+};
+
+
+template <class T, class Engine>
+inline bool unlimitedNumMixer<T, Engine>::isActive() const
+{
+	return true;
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: bitPoolBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures the time and the engine outputs per Bernoulli decision for the
+// ways the seers can decide: one bounded 0-9 roll per decision (as before the
+// bitPool), bitPool decisions one at a time, into a byte array, and 64 at a
+// time as a bit mask (bitPool::bernoulliMask).
+
+// ASSUMPTIONS:
+// * Usage: bitPoolBench. Probabilities are the seers' 3/10 (tmSeer's case
+// flips) and 5/10 (volatileSeer's rejections).
+// * Engine outputs are counted by wrapping the engine, so 32-bit engines
+// count two outputs per 64-bit word.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <cstdio>  // printf
+#include <random>  // mt19937
+
+
+#include "../include/bitPool.h"
+#include "../include/boundedRand.h"
+#include "../include/rngEngines.h"
+#include "benchUtil.h"
+
+
+template <class Engine>
+void runEngine(const char* engineName);
+
+template <class Engine, class Decide>
+void report(const char* engineName, const char* method, int chance,
+            std::size_t batch, Decide decide);
+
+
+int main()
+{
+	std::printf("%-12s %-8s %6s %14s %16s\n", "engine", "method", "chance",
+	            "ns/decision", "outputs/decision");
+	runEngine<std::mt19937>("mt19937");
+	runEngine<xoshiro256ss>("xoshiro256ss");
+	return 0;
+}
+
+
+template <class Engine>
+void runEngine(const char* engineName)
+{
+	const int ROLLS = 10;
+	const int CHANCES[] = {3, 5};
+	const std::size_t BLOCK_SIZE = 256;
+	for (int chance : CHANCES) {
+		const bitPool::probability p = bitPool::rational(chance, ROLLS);
+		bitPool pool;
+		unsigned char decisions[BLOCK_SIZE];
+
+		report<Engine>(engineName, "roll", chance, 1,
+		               [&](countingEngine<Engine>& eng) {
+			keep(boundedRand(eng, ROLLS) < static_cast<unsigned>(chance));
+		});
+		report<Engine>(engineName, "pool", chance, 1,
+		               [&](countingEngine<Engine>& eng) {
+			keep(pool.bernoulli(eng, p));
+		});
+		report<Engine>(engineName, "bytes", chance, BLOCK_SIZE,
+		               [&](countingEngine<Engine>& eng) {
+			pool.bernoulli(eng, p, decisions, BLOCK_SIZE);
+			keep(decisions);
+		});
+		report<Engine>(engineName, "mask", chance, 64,
+		               [&](countingEngine<Engine>& eng) {
+			keep(pool.bernoulliMask(eng, p, 64));
+		});
+	}
+}
+// DESCRIPTION:
+// * Reports every method with both probabilities for one engine.
+
+
+template <class Engine, class Decide>
+void report(const char* engineName, const char* method, int chance,
+            std::size_t batch, Decide decide)
+{
+	countingEngine<Engine> eng;
+	std::size_t decided = 0;
+	const double ns = nanosecondsPer([&] {
+		decide(eng);
+		decided += batch;
+	}, batch);
+	std::printf("%-12s %-8s %3d/10 %14.2f %16.4f\n", engineName, method,
+	            chance, ns, eng.calls / static_cast<double>(decided));
+}
+// DESCRIPTION:
+// * Prints the mean time and engine outputs per decision of "decide", which
+// makes "batch" decisions per call.
\ No newline at end of file
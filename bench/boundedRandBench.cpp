@@ -0,0 +1,88 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: boundedRandBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures boundedRand() against std::uniform_int_distribution, in ns and
+// engine outputs per draw, for every supported engine and for small, prime,
+// power-of-two and wide ranges.
+
+// ASSUMPTIONS:
+// * Usage: boundedRandBench.
+// * The distribution is constructed once per range, as numMixer did before
+// boundedRand, so only the per-draw cost is compared.
+// * Wide ranges are chosen to maximize rejections (just above a power of
+// two) and, past 2^32, to need two words from 32-bit engines.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <cstdio>  // printf
+#include <random>  // mt19937, uniform_int_distribution
+
+
+#include "../include/boundedRand.h"
+#include "../include/rngEngines.h"
+#include "benchUtil.h"
+
+
+template <class Engine>
+void runEngine(const char* engineName);
+
+
+int main()
+{
+	std::printf("%-12s %20s %12s %12s %8s %12s %12s\n", "engine", "range",
+	            "bounded ns", "std ns", "speedup", "bounded out", "std out");
+	runEngine<std::mt19937>("mt19937");
+	runEngine<xoshiro256ss>("xoshiro256ss");
+	runEngine<pcg64>("pcg64");
+	runEngine<splitMix64>("splitMix64");
+	return 0;
+}
+
+
+template <class Engine>
+void runEngine(const char* engineName)
+{
+	const std::uint64_t RANGES[] = {
+		10, 7, 1000003, 1 << 20, (1ULL << 31) + 1, (1ULL << 32) + 15,
+		(1ULL << 63) + 1
+	};
+	const std::size_t BATCH = 1024;
+	for (std::uint64_t range : RANGES) {
+		countingEngine<Engine> eng;
+		std::size_t draws = 0;
+		const double bounded = nanosecondsPer([&] {
+			std::uint64_t sum = 0;
+			for (std::size_t i = 0; i < BATCH; ++i) {
+				sum += boundedRand(eng, range);
+			}
+			keep(sum);
+			draws += BATCH;
+		}, BATCH);
+		const double boundedOutputs = eng.calls / static_cast<double>(draws);
+
+		std::uniform_int_distribution<std::uint64_t> values(0, range - 1);
+		eng.calls = 0;
+		draws = 0;
+		const double standard = nanosecondsPer([&] {
+			std::uint64_t sum = 0;
+			for (std::size_t i = 0; i < BATCH; ++i) {
+				sum += values(eng);
+			}
+			keep(sum);
+			draws += BATCH;
+		}, BATCH);
+		const double standardOutputs = eng.calls / static_cast<double>(draws);
+
+		std::printf("%-12s %20llu %12.2f %12.2f %7.1fx %12.3f %12.3f\n",
+		            engineName, static_cast<unsigned long long>(range),
+		            bounded, standard, standard / bounded, boundedOutputs,
+		            standardOutputs);
+	}
+}
+// DESCRIPTION:
+// * Reports both methods over every range with one engine.
\ No newline at end of file
@@ -0,0 +1,156 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: concurrentBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures quota contention in concurrentNumMixer as the number of pinging
+// threads grows from 1 to 64. Each round, the threads race to drain a fresh
+// concurrentNumMixer: they ping through their own handles until pings fail,
+// which exercises leasing from the countdown, stealing from other slots and
+// the final failing scan.
+// * Prints the mean time per round and per successful ping, and checks that
+// every round granted exactly the countdown's pings.
+
+// ASSUMPTIONS:
+// * Usage: concurrentBench [max threads] [rounds]. Defaults: 64 threads,
+// 2000 rounds.
+// * The countdown is 10-20 pings, as in numMixer, so a round is short and
+// its time includes waking the threads. The one-thread row is the baseline
+// for that overhead.
+// * Mixers share one dataset of 10^4 values and use 64 slots.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <chrono>  // steady_clock
+#include <condition_variable>  // condition_variable
+#include <memory>  // make_shared
+#include <mutex>  // mutex, unique_lock
+#include <thread>  // thread, hardware_concurrency
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/concurrentNumMixer.h"
+#include "../include/numDataset.h"
+#include "benchUtil.h"
+
+
+typedef basicConcurrentNumMixer<int> mixer;
+
+
+void runThreads(basicNumDatasetHandle<int> dataset, std::size_t threads,
+                std::size_t rounds);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t maxThreads = argumentOr(argc, argv, 1, 64);
+	const std::size_t rounds = argumentOr(argc, argv, 2, 2000);
+	const std::size_t SIZE = 10000;
+
+	std::vector<int> values(SIZE);
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		values[i] = static_cast<int>(i);
+	}
+	const basicNumDatasetHandle<int> dataset =
+		std::make_shared<const basicNumDataset<int> >(std::move(values));
+
+	std::printf("hardware threads: %u\n\n",
+	            std::thread::hardware_concurrency());
+	std::printf("%8s %12s %12s %8s\n", "threads", "us/round", "ns/ping",
+	            "exact");
+	for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+		runThreads(dataset, threads, rounds);
+	}
+	return 0;
+}
+
+
+void runThreads(basicNumDatasetHandle<int> dataset, std::size_t threads,
+                std::size_t rounds)
+{
+	const std::size_t PING_SIZE = 16;
+	std::mutex lock;
+	std::condition_variable changed;
+	std::vector<mixer::handle> handles;
+	std::size_t round = 0;
+	std::size_t running = 0;
+	std::size_t granted = 0;
+	bool stopping = false;
+
+	// each worker pings its handle until it fails, once per round
+	std::vector<std::thread> workers;
+	for (std::size_t t = 0; t < threads; ++t) {
+		workers.push_back(std::thread([&, t] {
+			std::vector<int> out(PING_SIZE);
+			std::size_t seen = 0;
+			while (true) {
+				{
+					std::unique_lock<std::mutex> guard(lock);
+					changed.wait(guard, [&] {
+						return stopping || round != seen;
+					});
+					if (stopping) {
+						return;
+					}
+					seen = round;
+				}
+				std::size_t succeeded = 0;
+				while (handles[t].ping(out)) {
+					++succeeded;
+				}
+				keep(out);
+				std::lock_guard<std::mutex> guard(lock);
+				granted += succeeded;
+				if (--running == 0) {
+					changed.notify_all();
+				}
+			}
+		}));
+	}
+
+	double seconds = 0;
+	std::size_t pings = 0;
+	bool exact = true;
+	for (std::size_t r = 0; r < rounds; ++r) {
+		mixer numMixerObj(dataset);
+		for (std::size_t t = 0; t < threads; ++t) {
+			handles.push_back(numMixerObj.makeHandle());
+		}
+		const int countDown = numMixerObj.remaining();
+
+		const std::chrono::steady_clock::time_point start =
+			std::chrono::steady_clock::now();
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			granted = 0;
+			running = threads;
+			++round;
+			changed.notify_all();
+			changed.wait(guard, [&] { return running == 0; });
+		}
+		seconds += secondsSince(start);
+		pings += granted;
+		exact = exact && (granted == static_cast<std::size_t>(countDown));
+		handles.clear();
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+		changed.notify_all();
+	}
+	for (std::size_t t = 0; t < threads; ++t) {
+		workers[t].join();
+	}
+	std::printf("%8zu %12.2f %12.1f %8s\n", threads, seconds * 1e6 / rounds,
+	            seconds * 1e9 / pings, exact ? "yes" : "NO");
+}
+// DESCRIPTION:
+// * Runs "rounds" rounds with "threads" threads draining a fresh
+// concurrentNumMixer over "dataset", and prints the mean time per round and
+// per successful ping, and whether every round granted exactly its
+// countdown.
\ No newline at end of file
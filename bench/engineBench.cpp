@@ -0,0 +1,118 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: engineBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Compares the supported random number engines: ns per raw 64 random bits,
+// ns per value of a 4096 value numMixer ping (MIX over 10^6 values), ns per
+// character of tmSeer case mixing (64 KiB messages), and the bytes each
+// engine adds to an object.
+
+// ASSUMPTIONS:
+// * Usage: engineBench.
+// * Object sizes are sizeof(), not counting heap memory such as the
+// dataset. The engine is held by value, so they show the per-object cost of
+// each engine's state: mt19937 keeps 624 words (5000 bytes with GCC's 64-bit
+// uint_fast32_t), the others 8 to 32 bytes.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <cstdio>  // printf
+#include <random>  // mt19937
+#include <string>  // string
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+#include "../include/tmSeer.h"
+#include "../include/volatileSeer.h"
+#include "benchUtil.h"
+
+
+template <class Engine>
+class benchTmSeer : public basicTmSeer<Engine>
+{
+	public:
+		benchTmSeer();
+		// DESCRIPTION:
+		// * Creates a tmSeer with a q of 1.
+
+		using basicTmSeer<Engine>::invertStringCase;
+};
+
+
+template <class Engine>
+benchTmSeer<Engine>::benchTmSeer():
+	seer(1),
+	basicTmSeer<Engine>(1)
+{
+}
+
+
+template <class Engine>
+void runEngine(const char* engineName);
+
+
+int main()
+{
+	std::printf("%-12s %10s %10s %10s %8s %10s %10s %12s\n", "engine",
+	            "ns/64 bits", "ping ns", "case ns", "engine B", "numMixer B",
+	            "tmSeer B", "volatile B");
+	runEngine<std::mt19937>("mt19937");
+	runEngine<xoshiro256ss>("xoshiro256ss");
+	runEngine<pcg64>("pcg64");
+	runEngine<splitMix64>("splitMix64");
+	return 0;
+}
+
+
+template <class Engine>
+void runEngine(const char* engineName)
+{
+	const std::size_t SIZE = 1000000;
+	const std::size_t PING_SIZE = 4096;
+	const std::size_t MESSAGE_SIZE = 1 << 16;
+	const std::size_t BATCH = 1024;
+
+	Engine eng(1);
+	const double raw = nanosecondsPer([&] {
+		std::uint64_t sum = 0;
+		for (std::size_t i = 0; i < BATCH; ++i) {
+			sum += randomWord64(eng);
+		}
+		keep(sum);
+	}, BATCH);
+
+	std::vector<int> values(SIZE);
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		values[i] = static_cast<int>(i);
+	}
+	unlimitedNumMixer<int, Engine> numMixerObj(std::move(values));
+	numMixerObj.setControllerState("MIX");
+	std::vector<int> out(PING_SIZE);
+	const double ping = nanosecondsPer([&] {
+		numMixerObj.ping(out.data(), PING_SIZE);
+		keep(out);
+	}, PING_SIZE);
+
+	benchTmSeer<Engine> seerObj;
+	std::string message(MESSAGE_SIZE, 'a');
+	const double caseMix = nanosecondsPer([&] {
+		seerObj.invertStringCase(message);
+		keep(message);
+	}, MESSAGE_SIZE);
+
+	std::printf("%-12s %10.2f %10.2f %10.2f %8zu %10zu %10zu %12zu\n",
+	            engineName, raw, ping, caseMix, sizeof(Engine),
+	            sizeof(basicNumMixer<int, Engine>),
+	            sizeof(basicTmSeer<Engine>),
+	            sizeof(basicVolatileSeer<Engine>));
+}
+// DESCRIPTION:
+// * Reports throughput and object sizes for one engine.
\ No newline at end of file
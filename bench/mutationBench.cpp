@@ -0,0 +1,180 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: mutationBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures numMixer under a mix of dataset mutations and pings: each step
+// replaces a random value with a random one (update(), which moves values
+// that change parity) and then pings 16 values, for MIX, EVEN, a registered
+// predicate controller and RANGE.
+// * Then runs the same mix concurrently: pinging threads and one mutating
+// thread share a mutex-guarded numMixer for one second.
+
+// ASSUMPTIONS:
+// * Usage: mutationBench [max size] [pinging threads]. Sizes go from 10^5 up
+// to the max size (default 10^7); threads default to the hardware threads.
+// * Values are uniform in [0, 10^9); the range is its middle half.
+// * The ping-only column isolates the cost the mutation adds to each step.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <atomic>  // atomic
+#include <chrono>  // steady_clock
+#include <mutex>  // mutex, lock_guard
+#include <random>  // mt19937
+#include <string>  // string
+#include <thread>  // thread
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+#include "benchUtil.h"
+
+
+typedef unlimitedNumMixer<int> mixer;
+
+
+void setUp(mixer& numMixerObj, const std::string& controller);
+
+void runSteps(std::size_t size, const std::string& controller);
+
+void runConcurrent(std::size_t size, std::size_t pingers);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t maxSize = argumentOr(argc, argv, 1, 10000000);
+	const std::size_t hardware = std::thread::hardware_concurrency();
+	const std::size_t pingers = argumentOr(argc, argv, 2,
+	                                       hardware > 0 ? hardware : 1);
+	const char* CONTROLLERS[] = {"MIX", "EVEN", "MULTIPLE_OF_3", "RANGE"};
+
+	std::printf("%10s %14s %16s %12s\n", "size", "controller",
+	            "ns/(update+ping)", "ns/ping");
+	for (std::size_t size = 100000; size <= maxSize; size *= 10) {
+		for (const char* controller : CONTROLLERS) {
+			runSteps(size, controller);
+		}
+	}
+
+	std::printf("\n%10s %8s %14s %14s\n", "size", "pingers", "pings/s",
+	            "updates/s");
+	for (std::size_t size = 100000; size <= maxSize; size *= 10) {
+		runConcurrent(size, pingers);
+	}
+	return 0;
+}
+
+
+void setUp(mixer& numMixerObj, const std::string& controller)
+{
+	numMixerObj.addPredicateController("MULTIPLE_OF_3", [](int value) {
+		return value % 3 == 0;
+	});
+	numMixerObj.buildRangeIndex();
+	if (controller == "RANGE") {
+		numMixerObj.setRange(250000000, 750000000);
+	} else {
+		numMixerObj.setControllerState(controller);
+	}
+}
+// DESCRIPTION:
+// * Registers the predicate controller, builds the range index and sets the
+// controller to "controller", so every structure a mutation patches exists.
+
+
+void runSteps(std::size_t size, const std::string& controller)
+{
+	const int MAX_VALUE = 1000000000;
+	const std::size_t PING_SIZE = 16;
+	std::mt19937 eng(size);
+	std::uniform_int_distribution<int> values(0, MAX_VALUE - 1);
+	std::vector<int> data(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		data[i] = values(eng);
+	}
+
+	mixer numMixerObj(std::move(data));
+	setUp(numMixerObj, controller);
+	int out[PING_SIZE];
+
+	const double pingOnly = nanosecondsPer([&] {
+		numMixerObj.ping(out, PING_SIZE);
+		keep(out);
+	});
+	const double step = nanosecondsPer([&] {
+		numMixerObj.update(eng() % size, values(eng));
+		numMixerObj.ping(out, PING_SIZE);
+		keep(out);
+	});
+	std::printf("%10zu %14s %16.1f %12.1f\n", size, controller.c_str(), step,
+	            pingOnly);
+}
+// DESCRIPTION:
+// * Prints the mean time of an update followed by a 16 value ping, and of
+// the ping alone, over "size" values with the given controller.
+
+
+void runConcurrent(std::size_t size, std::size_t pingers)
+{
+	const int MAX_VALUE = 1000000000;
+	const std::size_t PING_SIZE = 16;
+	const std::chrono::seconds DURATION(1);
+	std::mt19937 eng(size);
+	std::uniform_int_distribution<int> values(0, MAX_VALUE - 1);
+	std::vector<int> data(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		data[i] = values(eng);
+	}
+
+	mixer numMixerObj(std::move(data));
+	setUp(numMixerObj, "MULTIPLE_OF_3");
+	std::mutex lock;
+	std::atomic<bool> stopping(false);
+	std::atomic<std::size_t> pings(0);
+	std::size_t updates = 0;
+
+	std::vector<std::thread> threads;
+	for (std::size_t t = 0; t < pingers; ++t) {
+		threads.push_back(std::thread([&] {
+			int out[PING_SIZE];
+			std::size_t done = 0;
+			while (!stopping) {
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					numMixerObj.ping(out, PING_SIZE);
+				}
+				keep(out);
+				++done;
+			}
+			pings += done;
+		}));
+	}
+	threads.push_back(std::thread([&] {
+		std::mt19937 local(1);
+		while (!stopping) {
+			const std::size_t i = local() % size;
+			const int value = values(local);
+			std::lock_guard<std::mutex> guard(lock);
+			numMixerObj.update(i, value);
+			++updates;
+		}
+	}));
+
+	std::this_thread::sleep_for(DURATION);
+	stopping = true;
+	for (std::size_t t = 0; t < threads.size(); ++t) {
+		threads[t].join();
+	}
+	std::printf("%10zu %8zu %14.0f %14.0f\n", size, pingers,
+	            pings / static_cast<double>(DURATION.count()),
+	            updates / static_cast<double>(DURATION.count()));
+}
+// DESCRIPTION:
+// * Prints the pings and updates per second achieved by "pingers" threads
+// pinging 16 values of a registered controller and one thread updating
+// random values, all through one mutex, over "size" values.
\ No newline at end of file
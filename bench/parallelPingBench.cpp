@@ -0,0 +1,68 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: parallelPingBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures how the parallel ping (ping(values, pool)) scales with the
+// number of pool threads, from 1 to 64, for pings of 10^4 to 10^7 values
+// over 10^6 values (MIX), against the single-threaded ping.
+
+// ASSUMPTIONS:
+// * Usage: parallelPingBench [max threads] [max ping size]. Defaults: 64
+// threads, pings of 10^7 values.
+// * Speedups beyond the number of hardware threads (printed first) are not
+// expected; those rows show the cost of oversubscription.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <thread>  // hardware_concurrency
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+#include "../include/workerPool.h"
+#include "benchUtil.h"
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t maxThreads = argumentOr(argc, argv, 1, 64);
+	const std::size_t maxPing = argumentOr(argc, argv, 2, 10000000);
+	const std::size_t SIZE = 1000000;
+
+	std::vector<int> values(SIZE);
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		values[i] = static_cast<int>(i);
+	}
+	unlimitedNumMixer<int> numMixerObj(std::move(values));
+	numMixerObj.setControllerState("MIX");
+
+	std::printf("hardware threads: %u\n\n",
+	            std::thread::hardware_concurrency());
+	std::printf("%10s %8s %12s %10s\n", "ping size", "threads", "ns/value",
+	            "speedup");
+	for (std::size_t pingSize = 10000; pingSize <= maxPing; pingSize *= 10) {
+		std::vector<int> out(pingSize);
+		const double single = nanosecondsPer([&] {
+			numMixerObj.ping(out.data(), pingSize);
+			keep(out);
+		}, pingSize);
+		std::printf("%10zu %8s %12.3f %9.2fx\n", pingSize, "serial", single,
+		            1.0);
+
+		for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+			workerPool pool(threads);
+			const double parallel = nanosecondsPer([&] {
+				numMixerObj.ping(out, pool);
+				keep(out);
+			}, pingSize);
+			std::printf("%10zu %8zu %12.3f %9.2fx\n", pingSize, threads,
+			            parallel, single / parallel);
+		}
+	}
+	return 0;
+}
\ No newline at end of file
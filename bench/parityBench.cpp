@@ -0,0 +1,102 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: parityBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures the latency of EVEN, ODD and MIX pings as the share of odd
+// values falls from one half to a single odd value, to show that drawing
+// from the parity partition costs the same whatever the ratio.
+// * For contrast, times the rejection sampling numMixer used before (draw
+// from all values until one has the requested parity) for ODD.
+
+// ASSUMPTIONS:
+// * Usage: parityBench [size] [ping size]. Defaults: 10^6 values, pings of
+// 16 values.
+// * Odd values are spread evenly through the dataset before it is
+// partitioned; the rejection baseline draws from that unpartitioned order.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <random>  // mt19937
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+#include "../include/numMixer.h"
+#include "benchUtil.h"
+
+
+double pingNanoseconds(const std::vector<int>& values, const char* state,
+                       std::size_t pingSize);
+
+double rejectionNanoseconds(const std::vector<int>& values,
+                            std::size_t pingSize);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t size = argumentOr(argc, argv, 1, 1000000);
+	const std::size_t pingSize = argumentOr(argc, argv, 2, 16);
+	const std::size_t ODD_EVERY[] = {2, 10, 100, 1000, 10000, 0};
+
+	std::printf("%12s %10s %10s %10s %14s\n", "odd share", "EVEN ns",
+	            "ODD ns", "MIX ns", "rejection ns");
+	for (std::size_t every : ODD_EVERY) {
+		// every "every"-th value is odd, or only the first if 0
+		std::vector<int> values(size);
+		for (std::size_t i = 0; i < size; ++i) {
+			const bool odd = (every == 0) ? (i == 0) : (i % every == 0);
+			values[i] = 2 * static_cast<int>(i) + (odd ? 1 : 0);
+		}
+		const double oddShare = (every == 0) ? 1.0 / size : 1.0 / every;
+
+		std::printf("%12g %10.1f %10.1f %10.1f %14.1f\n", oddShare,
+		            pingNanoseconds(values, "EVEN", pingSize),
+		            pingNanoseconds(values, "ODD", pingSize),
+		            pingNanoseconds(values, "MIX", pingSize),
+		            rejectionNanoseconds(values, pingSize));
+	}
+	return 0;
+}
+
+
+double pingNanoseconds(const std::vector<int>& values, const char* state,
+                       std::size_t pingSize)
+{
+	std::vector<int> dataset(values);
+	unlimitedNumMixer<int> numMixerObj(std::move(dataset));
+	numMixerObj.setControllerState(state);
+	std::vector<int> out(pingSize);
+	return nanosecondsPer([&] {
+		numMixerObj.ping(out.data(), pingSize);
+		keep(out);
+	});
+}
+// DESCRIPTION:
+// * Returns the mean ns per ping of "pingSize" values with the controller
+// in "state".
+
+
+double rejectionNanoseconds(const std::vector<int>& values,
+                            std::size_t pingSize)
+{
+	std::mt19937 eng(1);
+	std::vector<int> out(pingSize);
+	return nanosecondsPer([&] {
+		for (std::size_t i = 0; i < pingSize; ++i) {
+			int value;
+			do {
+				value = values[boundedRand(eng, values.size())];
+			} while (value % 2 == 0);
+			out[i] = value;
+		}
+		keep(out);
+	});
+}
+// DESCRIPTION:
+// * Returns the mean ns per ping of "pingSize" odd values drawn by rejection
+// from all of "values".
\ No newline at end of file
@@ -0,0 +1,125 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: prefetchBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Sweeps the dataset size from 16 KiB (L1) to past the last level cache,
+// timing per value:
+//   1. numMixer pings of 4096 values over all values (MIX), which prefetch
+// above the 4 MiB threshold in numMixer.cpp;
+//   2. a replica of numMixer's gather alone, over 2^16 indexes drawn
+// beforehand and read 256 at a time, with no prefetching and with prefetch
+// distances of 4 to 64 indexes.
+// * The replica isolates the threshold and distance choices from the cost
+// of drawing indexes, which is the same whatever the gather does.
+
+// ASSUMPTIONS:
+// * Usage: prefetchBench [max MiB]. The default of 1024 MiB fits the
+// sandbox; the dataset and the numMixer's copy both stay resident, so about
+// twice the size must fit in memory.
+// * Values are ints and sizes grow 4 times per step.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint32_t
+#include <cstdio>  // printf
+#include <random>  // mt19937
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+#include "../include/numMixer.h"
+#include "benchUtil.h"
+
+
+template <std::size_t DISTANCE>
+double gatherNanoseconds(const std::vector<int>& values,
+                         const std::vector<std::uint32_t>& indexes);
+
+double pingNanoseconds(std::vector<int> values);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t maxMiB = argumentOr(argc, argv, 1, 1024);
+	const std::size_t MIN_BYTES = 16 << 10;
+	const std::size_t INDEXES = 1 << 16;
+
+	std::printf("%10s %10s %8s %8s %8s %8s %8s %8s\n", "KiB", "ping", "none",
+	            "d=4", "d=8", "d=16", "d=32", "d=64");
+	for (std::size_t bytes = MIN_BYTES; bytes <= (maxMiB << 20); bytes *= 4) {
+		std::vector<int> values(bytes / sizeof(int));
+		std::mt19937 eng(1);
+		for (std::size_t i = 0; i < values.size(); ++i) {
+			values[i] = static_cast<int>(eng());
+		}
+		std::vector<std::uint32_t> indexes(INDEXES);
+		for (std::size_t i = 0; i < INDEXES; ++i) {
+			indexes[i] = boundedRand32(eng, values.size());
+		}
+
+		std::printf("%10zu %10.2f %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+		            bytes >> 10, pingNanoseconds(values),
+		            gatherNanoseconds<0>(values, indexes),
+		            gatherNanoseconds<4>(values, indexes),
+		            gatherNanoseconds<8>(values, indexes),
+		            gatherNanoseconds<16>(values, indexes),
+		            gatherNanoseconds<32>(values, indexes),
+		            gatherNanoseconds<64>(values, indexes));
+		std::fflush(stdout);
+	}
+	return 0;
+}
+
+
+template <std::size_t DISTANCE>
+double gatherNanoseconds(const std::vector<int>& values,
+                         const std::vector<std::uint32_t>& indexes)
+{
+	const std::size_t BLOCK_SIZE = 256;
+	const int* partition = values.data();
+	int out[BLOCK_SIZE];
+	std::size_t block = 0;
+
+	return nanosecondsPer([&] {
+		const std::uint32_t* next = indexes.data() + block;
+		block = (block + BLOCK_SIZE) % indexes.size();
+		std::size_t i = 0;
+		if (DISTANCE > 0) {
+			for (; i < DISTANCE; ++i) {
+				__builtin_prefetch(partition + next[i]);
+			}
+			for (i = 0; i < BLOCK_SIZE - DISTANCE; ++i) {
+				__builtin_prefetch(partition + next[i + DISTANCE]);
+				out[i] = partition[next[i]];
+			}
+		}
+		for (; i < BLOCK_SIZE; ++i) {
+			out[i] = partition[next[i]];
+		}
+		keep(out);
+	}, BLOCK_SIZE);
+}
+// DESCRIPTION:
+// * Returns the mean ns per value of gathering "values" at "indexes", a
+// block of 256 at a time, prefetching DISTANCE indexes ahead (none if 0), as
+// numMixer's gather does.
+
+
+double pingNanoseconds(std::vector<int> values)
+{
+	const std::size_t PING_SIZE = 4096;
+	unlimitedNumMixer<int> numMixerObj(std::move(values));
+	std::vector<int> out(PING_SIZE);
+	numMixerObj.setControllerState("MIX");
+	return nanosecondsPer([&] {
+		numMixerObj.ping(out.data(), PING_SIZE);
+		keep(out);
+	}, PING_SIZE);
+}
+// DESCRIPTION:
+// * Returns the mean ns per value of numMixer pings of 4096 values over
+// "values".
\ No newline at end of file
@@ -0,0 +1,134 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: prefillBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures ping latency under bursts: each burst is 10 back to back pings
+// (the least a countdown allows) of a fresh prefillNumMixer whose rings
+// were filled while it was idle. Prints the p50, p99 and maximum latency of
+// a ping, and the share of pings that underran, against the same pings
+// drawn directly by a numMixer.
+// * Ping sizes grow from a small fraction of a ring to more than the ring
+// holds, so late pings of a burst find the ring drained unless the producer
+// keeps up.
+
+// ASSUMPTIONS:
+// * Usage: prefillBench [bursts]. Default: 1000 bursts per ping size.
+// * Rings hold 4096 values. The dataset is 10^6 stored values, so a direct
+// draw gathers from memory beyond the caches.
+// * Each ping is timed on its own, so latencies include about one clock read.
+// * The producer runs on its own thread: with a single hardware thread it
+// competes with the pings for the core, and underruns grow.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <cstdio>  // printf
+#include <algorithm>  // sort
+#include <chrono>  // steady_clock, duration
+#include <memory>  // make_shared
+#include <thread>  // this_thread, hardware_concurrency
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+#include "../include/prefillNumMixer.h"
+#include "benchUtil.h"
+
+
+const std::size_t BUFFER_SIZE = 4096;
+// Values per ring.
+
+const int BURST = 10;
+// Pings per burst.
+
+
+void runSize(basicNumDatasetHandle<int> dataset, std::size_t pingSize,
+             std::size_t bursts);
+
+void report(const char* mixerName, std::size_t pingSize,
+            std::vector<double>& latencies, double underrunShare);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t bursts = argumentOr(argc, argv, 1, 1000);
+	const std::size_t SIZE = 1000000;
+	const std::size_t PING_SIZES[] = {16, 256, 1024, 4096, 8192};
+
+	std::vector<int> values(SIZE);
+	for (std::size_t i = 0; i < SIZE; ++i) {
+		values[i] = static_cast<int>(i * 7919 % SIZE);
+	}
+	const basicNumDatasetHandle<int> dataset =
+		std::make_shared<const basicNumDataset<int> >(std::move(values));
+
+	std::printf("hardware threads: %u\n\n",
+	            std::thread::hardware_concurrency());
+	std::printf("%-8s %6s %12s %12s %12s %10s\n", "mixer", "values",
+	            "p50 ns", "p99 ns", "max ns", "underruns");
+	for (std::size_t pingSize : PING_SIZES) {
+		runSize(dataset, pingSize, bursts);
+	}
+	return 0;
+}
+
+
+void runSize(basicNumDatasetHandle<int> dataset, std::size_t pingSize,
+             std::size_t bursts)
+{
+	std::vector<int> out(pingSize);
+	std::vector<double> prefilled;
+	std::vector<double> direct;
+	std::uint64_t underruns = 0;
+
+	for (std::size_t b = 0; b < bursts; ++b) {
+		prefillNumMixer numMixerObj(dataset, BUFFER_SIZE);
+		while (numMixerObj.buffered(numMixerTypes::MIX) < BUFFER_SIZE) {
+			std::this_thread::yield();
+		}
+		for (int p = 0; p < BURST; ++p) {
+			const std::chrono::steady_clock::time_point start =
+				std::chrono::steady_clock::now();
+			numMixerObj.ping(out);
+			prefilled.push_back(secondsSince(start) * 1e9);
+			keep(out);
+		}
+		underruns += numMixerObj.underrunCount();
+	}
+
+	unlimitedNumMixer<int> numMixerObj(dataset);
+	for (std::size_t p = 0; p < bursts * BURST; ++p) {
+		const std::chrono::steady_clock::time_point start =
+			std::chrono::steady_clock::now();
+		numMixerObj.ping(out);
+		direct.push_back(secondsSince(start) * 1e9);
+		keep(out);
+	}
+
+	report("prefill", pingSize, prefilled,
+	       underruns / static_cast<double>(bursts * BURST));
+	report("direct", pingSize, direct, 1);
+}
+// DESCRIPTION:
+// * Times "bursts" bursts of pings of "pingSize" values through fresh
+// prefillNumMixers over "dataset", then as many pings drawn directly, and
+// reports both.
+
+
+void report(const char* mixerName, std::size_t pingSize,
+            std::vector<double>& latencies, double underrunShare)
+{
+	std::sort(latencies.begin(), latencies.end());
+	const std::size_t n = latencies.size();
+	std::printf("%-8s %6zu %12.0f %12.0f %12.0f %9.1f%%\n", mixerName,
+	            pingSize, latencies[n / 2], latencies[n * 99 / 100],
+	            latencies[n - 1], underrunShare * 100);
+}
+// DESCRIPTION:
+// * Prints the p50, p99 and maximum of "latencies", sorting them, and the
+// share of pings that underran (all of them, for direct draws).
\ No newline at end of file
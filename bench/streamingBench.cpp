@@ -0,0 +1,126 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: streamingBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures streamingNumMixer ingestion throughput, in ns per value, by
+// reservoir capacity: values offered in blocks (offer()), and the same
+// values read from a std::istream on the background thread (ingest()).
+// * Compares a single reservoir kept with Algorithm R, one random draw per
+// value, which is what Algorithm L's skips avoid.
+
+// ASSUMPTIONS:
+// * Usage: streamingBench [stream size]. Default: 10^7 values, offered in
+// blocks of 4096 like the ingesting thread reads them.
+// * Algorithm L still classifies every value for the EVEN and ODD
+// reservoirs, so its cost per value does not fall to zero as the MIX
+// reservoir skips more of the stream.
+// * offer() publishes the reservoirs after every block, copying all three,
+// which dominates at large capacities; ingest() publishes about once per
+// capacity values.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <chrono>  // steady_clock
+#include <random>  // mt19937
+#include <sstream>  // istringstream
+#include <string>  // string
+#include <thread>  // this_thread
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+#include "../include/streamingNumMixer.h"
+#include "benchUtil.h"
+
+
+void runCapacity(const std::vector<int>& stream, std::size_t capacity);
+
+double algorithmR(const std::vector<int>& stream, std::size_t capacity);
+
+
+int main(int argc, char** argv)
+{
+	const std::size_t size = argumentOr(argc, argv, 1, 10000000);
+	const std::size_t CAPACITIES[] = {16, 256, 4096, 65536};
+
+	std::mt19937 eng(1);
+	std::vector<int> stream(size);
+	for (std::size_t i = 0; i < size; ++i) {
+		stream[i] = static_cast<int>(eng());
+	}
+
+	std::printf("%10s %12s %12s %14s\n", "capacity", "offer ns", "ingest ns",
+	            "algorithm R ns");
+	for (std::size_t capacity : CAPACITIES) {
+		runCapacity(stream, capacity);
+	}
+	return 0;
+}
+
+
+void runCapacity(const std::vector<int>& stream, std::size_t capacity)
+{
+	const std::size_t BLOCK_SIZE = 4096;
+	const std::size_t size = stream.size();
+
+	std::chrono::steady_clock::time_point start =
+		std::chrono::steady_clock::now();
+	{
+		streamingNumMixer mixer(capacity);
+		for (std::size_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+			const std::size_t count = (size - begin < BLOCK_SIZE)
+			                          ? size - begin : BLOCK_SIZE;
+			mixer.offer(stream.data() + begin, count);
+		}
+		keep(mixer.seen());
+	}
+	const double offered = secondsSince(start) * 1e9 / size;
+
+	std::istringstream in(std::string(
+		reinterpret_cast<const char*>(stream.data()), size * sizeof(int)));
+	start = std::chrono::steady_clock::now();
+	{
+		streamingNumMixer mixer(capacity);
+		mixer.ingest(in);
+		while (mixer.ingesting()) {
+			std::this_thread::yield();
+		}
+		keep(mixer.seen());
+	}
+	const double ingested = secondsSince(start) * 1e9 / size;
+
+	std::printf("%10zu %12.2f %12.2f %14.2f\n", capacity, offered, ingested,
+	            algorithmR(stream, capacity));
+}
+// DESCRIPTION:
+// * Prints the ns per value of offering and of ingesting "stream" with
+// reservoirs of "capacity", and of Algorithm R.
+
+
+double algorithmR(const std::vector<int>& stream, std::size_t capacity)
+{
+	std::mt19937 eng(2);
+	std::vector<int> reservoir;
+	reservoir.reserve(capacity);
+	const std::chrono::steady_clock::time_point start =
+		std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < stream.size(); ++i) {
+		if (i < capacity) {
+			reservoir.push_back(stream[i]);
+		} else {
+			const std::size_t j = boundedRand(eng, i + 1);
+			if (j < capacity) {
+				reservoir[j] = stream[i];
+			}
+		}
+	}
+	keep(reservoir.data());
+	return secondsSince(start) * 1e9 / stream.size();
+}
+// DESCRIPTION:
+// * Returns the ns per value of keeping one reservoir of "capacity" values
+// of "stream" with Algorithm R.
\ No newline at end of file
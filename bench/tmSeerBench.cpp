@@ -0,0 +1,95 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: tmSeerBench.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Measures tmSeer::invertStringCase by message length, from 16 bytes to
+// 64 KiB, in the compatibility mode (one bounded 0-9 roll per character,
+// applied in bulk) and the default mode (bitPool flip masks).
+
+// ASSUMPTIONS:
+// * Usage: tmSeerBench. Messages are printable ASCII, three quarters
+// letters, like the hidden message.
+// * Rebuilding with TMSEER_NO_SIMD measures the scalar kernels.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <random>  // mt19937
+#include <string>  // string
+
+
+#include "../include/rngEngines.h"
+#include "../include/tmSeer.h"
+#include "benchUtil.h"
+
+
+template <class Engine>
+class benchTmSeer : public basicTmSeer<Engine>
+{
+	public:
+		benchTmSeer();
+		// DESCRIPTION:
+		// * Creates a tmSeer with a q of 1.
+
+		using basicTmSeer<Engine>::invertStringCase;
+};
+
+
+template <class Engine>
+benchTmSeer<Engine>::benchTmSeer():
+	seer(1),
+	basicTmSeer<Engine>(1)
+{
+}
+
+
+template <class Engine>
+void runEngine(const char* engineName);
+
+
+int main()
+{
+	std::printf("%-12s %8s %16s %14s %8s\n", "engine", "length",
+	            "compatible ns/ch", "default ns/ch", "speedup");
+	runEngine<std::mt19937>("mt19937");
+	runEngine<xoshiro256ss>("xoshiro256ss");
+	return 0;
+}
+
+
+template <class Engine>
+void runEngine(const char* engineName)
+{
+	const std::size_t MIN_LENGTH = 16;
+	const std::size_t MAX_LENGTH = 1 << 16;
+	const char ALPHABET[] = "abcdefghijklmnopqrstuvwxyz"
+	                        "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 .,!?";
+	benchTmSeer<Engine> seerObj;
+	std::mt19937 eng(1);
+
+	for (std::size_t length = MIN_LENGTH; length <= MAX_LENGTH; length *= 4) {
+		std::string message(length, ' ');
+		for (std::size_t i = 0; i < length; ++i) {
+			message[i] = ALPHABET[eng() % (sizeof(ALPHABET) - 1)];
+		}
+
+		seerObj.setCompatibilityMode(true);
+		const double compatible = nanosecondsPer([&] {
+			seerObj.invertStringCase(message);
+			keep(message);
+		}, length);
+		seerObj.setCompatibilityMode(false);
+		const double fast = nanosecondsPer([&] {
+			seerObj.invertStringCase(message);
+			keep(message);
+		}, length);
+		std::printf("%-12s %8zu %16.2f %14.2f %7.1fx\n", engineName, length,
+		            compatible, fast, compatible / fast);
+	}
+}
+// DESCRIPTION:
+// * Reports both modes for message lengths 16, 64, ..., 64 KiB with one
+// engine.
\ No newline at end of file
@@ -1,3 +1,22 @@
-& g++ -std=c++11 -pedantic ./src/*.cpp -o ./bin/main
+& g++ -std=c++11 -pedantic -pthread ./src/*.cpp -o ./bin/main
 
-& ./bin/main.exe
\ No newline at end of file
+& ./bin/main.exe
+
+# Optimized library objects, shared by the tests and benchmarks
+New-Item -ItemType Directory -Force ./bin/obj | Out-Null
+foreach ($source in Get-ChildItem ./src/*.cpp -Exclude main.cpp) {
+	& g++ -std=c++11 -pedantic -pthread -O2 -march=native -c $source.FullName -o ("./bin/obj/" + $source.BaseName + ".o")
+}
+$objects = (Get-ChildItem ./bin/obj/*.o).FullName
+
+# Tests: one program per test/*.cpp, each exiting non-zero on failure
+foreach ($test in Get-ChildItem ./test/*.cpp) {
+	& g++ -std=c++11 -pedantic -pthread -O2 -march=native $test.FullName $objects -o ("./bin/" + $test.BaseName)
+	& ("./bin/" + $test.BaseName + ".exe")
+}
+
+# Benchmarks: one program per bench/*.cpp, run by hand (e.g.
+# ./bin/mutationBench.exe)
+foreach ($bench in Get-ChildItem ./bench/*.cpp) {
+	& g++ -std=c++11 -pedantic -pthread -O2 -march=native $bench.FullName $objects -o ("./bin/" + $bench.BaseName)
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: aliasTable.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * Once built, every column i is drawn with probability 1 / size(), and then
+// yields i with probability threshold / 2^32 and its alias otherwise, so i is
+// returned overall with probability weight(i) / totalWeight().
+
+// DESCRIPTION:
+// * A Walker/Vose alias table for drawing indexes in proportion to their
+// weights in O(1): one bounded random index and one 32-bit coin flip.
+
+// ASSUMPTIONS:
+// * The table is built in O(n) with Vose's method. Column probabilities are
+// stored as 32-bit fixed point thresholds next to their alias, so a draw
+// touches a single 8-byte column and never uses floating point.
+// * Weight updates are O(1). The table cannot in general be patched in place
+// when one weight changes (every column's height depends on the total), so
+// updates are batched: the table is rebuilt once by the next build() call,
+// reusing its buffers, no matter how many weights changed.
+// * Weights must be finite and non-negative. A table whose weights sum to 0
+// is empty and cannot be drawn from.
+// * Engines must return 32-bit words (see wordEngine).
+// * A table holds fewer than 2^32 weights.
+
+
+#ifndef aliasTable_INCLUDED
+#define aliasTable_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint32_t
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+
+
+class aliasTable
+{
+	public:
+		// Constructors
+
+		aliasTable();
+		// DESCRIPTION:
+		// * Creates an empty table.
+
+		aliasTable(const std::vector<double>& weights);
+		// DESCRIPTION:
+		// * Creates and builds a table drawing index i in proportion to
+		// "weights"[i].
+		//
+		// POSTCONDITIONS:
+		// * The table is empty if any weight is negative or not finite.
+
+
+		// Functionality
+
+		template <class Engine>
+		std::size_t sample(Engine& eng) const;
+		// DESCRIPTION:
+		// * Returns a random index, drawn in proportion to its weight.
+		//
+		// PRECONDITIONS:
+		// * The table must be built and non-empty.
+
+		void build();
+		// DESCRIPTION:
+		// * Rebuilds the table if any weight changed since the last build.
+
+
+		// Accessors
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the number of weights.
+
+		bool empty() const;
+		// DESCRIPTION:
+		// * Returns whether no index can be drawn (no weights, or a total
+		// weight of 0).
+
+		double weight(std::size_t i) const;
+		// DESCRIPTION:
+		// * Returns the weight of index "i".
+
+		double totalWeight() const;
+		// DESCRIPTION:
+		// * Returns the sum of the weights.
+
+
+		// Mutators
+
+		bool setWeight(std::size_t i, double weight);
+		// DESCRIPTION:
+		// * Changes the weight of index "i" to "weight".
+		// * Returns false, changing nothing, if "i" is out of range or
+		// "weight" is negative or not finite.
+		//
+		// POSTCONDITIONS:
+		// * build() must be called before the next draw.
+
+
+	private:
+		// Types
+
+		struct column
+		{
+			std::uint32_t threshold;
+			std::uint32_t alias;
+		};
+		// A column of the table: keep the column's own index if the coin is
+		// below threshold, otherwise return alias.
+
+
+		// Members
+
+		std::vector<double> _weights;
+		// The weight of every index.
+
+		double _total;
+		// The sum of _weights.
+
+		std::vector<column> _columns;
+		// The table, one column per index.
+
+		std::vector<double> _scaled;
+		std::vector<std::uint32_t> _small;
+		std::vector<std::uint32_t> _large;
+		// Scaled weights and work lists of under- and overfull columns, kept
+		// between builds.
+
+		bool _dirty;
+		// Whether a weight changed since the last build.
+};
+
+
+template <class Engine>
+inline std::size_t aliasTable::sample(Engine& eng) const
+{
+	const std::size_t i = boundedRand(eng, _columns.size());
+	const column& col = _columns[i];
+	if (static_cast<std::uint32_t>(eng()) < col.threshold) {
+		return i;
+	} else {
+		return col.alias;
+	}
+}
+
+
+inline std::size_t aliasTable::size() const
+{
+	return _weights.size();
+}
+
+
+inline bool aliasTable::empty() const
+{
+	return !(_total > 0);
+}
+
+
+inline double aliasTable::weight(std::size_t i) const
+{
+	return _weights[i];
+}
+
+
+inline double aliasTable::totalWeight() const
+{
+	return _total;
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,376 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: bitPool.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * The pool holds the unused bits of the last engine word drawn, and only
+// those: every bit is used for at most one decision.
+
+// DESCRIPTION:
+// * Header-only pool of random bits for Bernoulli decisions, shared by tmSeer
+// and volatileSeer. Engine words are drawn 64 bits at a time and spent a few
+// bits per decision, so one word settles many coin flips instead of one.
+// * A decision with probability p = numerator / denominator compares a
+// uniform binary fraction U, read from the pool, with the binary expansion of
+// p, and succeeds if U < p. The comparison stops at the first bit where they
+// differ, which takes 2 bits on average, whatever p is, and the decisions are
+// exactly unbiased.
+
+// ASSUMPTIONS:
+// * Engines return uniformly distributed words (see boundedRand.h). The pool
+// does not hold an engine; each call takes the engine to draw from, like
+// boundedRand(). A pool must always be used with the same engine. Pooled bits
+// stay uniform across a reseed, so clearing the pool then is only needed to
+// reproduce the decisions that follow a given seed.
+// * Probabilities are rationals with a denominator of at most 2^32. The first
+// 64 bits of the expansion are computed once per probability and compared 64
+// bits at a time: the first differing bit is found with one count of leading
+// zeros. Later bits are only computed in the rare case (2^-64) all 64 match.
+// * A probability whose expansion ends (a denominator that is a power of two)
+// only uses the bits up to its last 1, so a fair coin takes exactly 1 bit.
+// * bernoulliMask() decides up to 64 lanes at once, bit-sliced: each round
+// compares one bit of every undecided lane's U with the same bit of p, using
+// a handful of word operations for all lanes, and about half the lanes
+// settle per round. Fresh pool bits are deposited into just the undecided
+// lanes, so each decision still takes 2 bits on average: with BMI2 by one
+// PDEP, without it (or when BITPOOL_NO_SIMD is defined) one undecided lane at
+// a time. Decisions are exactly unbiased, though lanes read random bits in a
+// different order than successive bernoulli() calls would.
+
+
+#ifndef bitPool_INCLUDED
+#define bitPool_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint32_t, uint64_t
+
+
+#if !defined(BITPOOL_NO_SIMD) && defined(__BMI2__)
+#include <immintrin.h>  // _pdep_u64
+#define BITPOOL_BMI2
+#endif
+
+
+#include "../include/boundedRand.h"
+
+
+class bitPool
+{
+	public:
+		// Types
+
+		struct probability
+		{
+			std::uint64_t expansion;
+			std::uint64_t rest;
+			std::uint64_t denominator;
+			unsigned length;
+		};
+		// A precomputed probability: the first 64 bits of its binary
+		// expansion, the numerator of the remainder after them, its
+		// denominator, and the number of expansion bits worth comparing.
+
+
+		// Constructors
+
+		bitPool();
+		// DESCRIPTION:
+		// * Creates an empty pool.
+
+
+		// Functionality
+
+		static probability rational(std::uint32_t numerator,
+		                            std::uint64_t denominator);
+		// DESCRIPTION:
+		// * Returns the probability "numerator" / "denominator", clamped to
+		// 1.
+		//
+		// PRECONDITIONS:
+		// * "denominator" must be greater than 0 and at most 2^32.
+
+		template <class Engine>
+		bool bernoulli(Engine& eng, const probability& p);
+		// DESCRIPTION:
+		// * Returns true with probability "p", drawing from "eng" only when
+		// the pool runs dry.
+
+		template <class Engine>
+		void bernoulli(Engine& eng, const probability& p,
+		               unsigned char* decisions, std::size_t count);
+		// DESCRIPTION:
+		// * Stores "count" independent decisions with probability "p" into
+		// "decisions", 1 for true and 0 for false.
+
+		template <class Engine>
+		std::uint64_t bernoulliMask(Engine& eng, const probability& p,
+		                            unsigned count);
+		// DESCRIPTION:
+		// * Returns "count" independent decisions with probability "p" as
+		// the low "count" bits of a word, bit i set for a true decision i.
+		//
+		// PRECONDITIONS:
+		// * "count" must be between 1 and 64.
+
+		void clear();
+		// DESCRIPTION:
+		// * Discards the pooled bits. Optional after reseeding the engine:
+		// it makes the following decisions depend on the seed alone.
+
+
+	private:
+		// Members
+
+		std::uint64_t _bits;
+		// The unused bits, at the top of the word.
+
+		unsigned _left;
+		// The number of unused bits.
+
+
+		// Utility
+
+		template <class Engine>
+		bool settle(Engine& eng, const probability& p);
+		// DESCRIPTION:
+		// * Decides "p" when the pooled bits run out (or all match) before
+		// a differing bit: refills the pool and extends the expansion as
+		// needed.
+
+		template <class Engine>
+		std::uint64_t take(Engine& eng, unsigned count);
+		// DESCRIPTION:
+		// * Returns the next "count" (1-64) pooled bits as the low bits of a
+		// word, refilling the pool as needed.
+
+		void consume(unsigned count);
+		// DESCRIPTION:
+		// * Drops the top "count" (1-64) pooled bits.
+
+		static std::uint64_t deposit(std::uint64_t bits, std::uint64_t mask);
+		// DESCRIPTION:
+		// * Returns the low bits of "bits", in order, moved to the positions
+		// of the set bits of "mask" (PDEP).
+};
+
+
+inline bitPool::bitPool():
+	_bits(0),
+	_left(0)
+{
+}
+
+
+inline bitPool::probability bitPool::rational(std::uint32_t numerator,
+                                              std::uint64_t denominator)
+{
+	probability p;
+	p.denominator = denominator;
+	if (numerator >= denominator) {
+		// certain: nothing to compare, flagged by a full remainder
+		p.expansion = 0;
+		p.rest = denominator;
+		p.length = 0;
+		return p;
+	}
+
+	// long division, 32 bits at a time
+	const std::uint64_t high = (static_cast<std::uint64_t>(numerator) << 32)
+	                           / denominator;
+	const std::uint64_t middle = (static_cast<std::uint64_t>(numerator) << 32)
+	                             % denominator;
+	const std::uint64_t low = (middle << 32) / denominator;
+	p.expansion = (high << 32) | low;
+	p.rest = (middle << 32) % denominator;
+	p.length = (p.rest != 0) ? 64
+	         : (p.expansion != 0) ? 64 - __builtin_ctzll(p.expansion)
+	         : 0;
+	return p;
+}
+
+
+template <class Engine>
+inline bool bitPool::bernoulli(Engine& eng, const probability& p)
+{
+	// common case: the pooled bits settle p, either differing within both
+	// (U < p exactly when p has the 1 there) or matching all of a finite p
+	// (U >= p); the outcome is selected without branching on it
+	const std::uint64_t differ = _bits ^ p.expansion;
+	const unsigned first = (differ != 0) ? __builtin_clzll(differ) : 64;
+	const unsigned differs = first < p.length;
+	const unsigned used = p.length
+	                      + ((first + 1 - p.length) & (0u - differs));
+	if (used <= _left && (p.rest == 0 || differs) && used > 0) {
+		const bool decision = differs & ((p.expansion << (first & 63)) >> 63);
+		consume(used);
+		return decision;
+	}
+	return settle(eng, p);
+}
+
+
+template <class Engine>
+inline void bitPool::bernoulli(Engine& eng, const probability& p,
+                               unsigned char* decisions, std::size_t count)
+{
+	// the pool lives in locals: stores through "decisions" could alias it
+	std::uint64_t bits = _bits;
+	unsigned left = _left;
+	for (std::size_t i = 0; i < count; ++i) {
+		const std::uint64_t differ = bits ^ p.expansion;
+		const unsigned first = (differ != 0) ? __builtin_clzll(differ) : 64;
+		const unsigned differs = first < p.length;
+		const unsigned used = p.length
+		                      + ((first + 1 - p.length) & (0u - differs));
+		if (used <= left && (p.rest == 0 || differs) && used > 0) {
+			decisions[i] = differs & ((p.expansion << (first & 63)) >> 63);
+			bits = (used == 64) ? 0 : bits << used;
+			left -= used;
+		} else {
+			_bits = bits;
+			_left = left;
+			decisions[i] = settle(eng, p) ? 1 : 0;
+			bits = _bits;
+			left = _left;
+		}
+	}
+	_bits = bits;
+	_left = left;
+}
+
+
+template <class Engine>
+std::uint64_t bitPool::bernoulliMask(Engine& eng, const probability& p,
+                                     unsigned count)
+{
+	const std::uint64_t all = (count == 64) ? ~0ULL : (1ULL << count) - 1;
+	if (p.rest == p.denominator) {
+		return all;
+	}
+
+	// round k compares bit k of every undecided U with bit k of p; a lane
+	// settles where they differ, true where p has the 1
+	std::uint64_t result = 0;
+	std::uint64_t undecided = all;
+	std::uint64_t expansion = p.expansion;
+	std::uint64_t rest = p.rest;
+	unsigned length = p.length;
+	while (undecided != 0 && length > 0) {
+		const std::uint64_t plane = deposit(
+			take(eng, __builtin_popcountll(undecided)), undecided);
+		const std::uint64_t pk = 0 - (expansion >> 63);
+		const std::uint64_t differ = (plane ^ pk) & undecided;
+		result |= differ & pk;
+		undecided &= ~differ;
+		expansion <<= 1;
+		--length;
+
+		if (length == 0 && rest != 0) {
+			// 64 bits matched in some lane: continue with the next 64
+			const probability next = rational(
+				static_cast<std::uint32_t>(rest), p.denominator);
+			expansion = next.expansion;
+			rest = next.rest;
+			length = next.length;
+		}
+	}
+
+	// lanes still undecided matched every bit of p: U >= p
+	return result;
+}
+
+
+template <class Engine>
+bool bitPool::settle(Engine& eng, const probability& p)
+{
+	std::uint64_t expansion = p.expansion;
+	std::uint64_t rest = p.rest;
+	unsigned length = p.length;
+	while (length > 0) {
+		if (_left == 0) {
+			_bits = randomWord64(eng);
+			_left = 64;
+		}
+
+		const unsigned n = (_left < length) ? _left : length;
+		const std::uint64_t differ = (_bits ^ expansion) & (~0ULL << (64 - n));
+		if (differ != 0) {
+			const unsigned first = __builtin_clzll(differ);
+			consume(first + 1);
+			return ((expansion >> (63 - first)) & 1) != 0;
+		}
+		consume(n);
+		expansion = (n == 64) ? 0 : expansion << n;
+		length -= n;
+
+		if (length == 0 && rest != 0) {
+			// all 64 bits matched: continue with the next 64
+			const probability next = rational(
+				static_cast<std::uint32_t>(rest), p.denominator);
+			expansion = next.expansion;
+			rest = next.rest;
+			length = next.length;
+		}
+	}
+
+	// U matched every bit of p: U >= p, except for p == 1
+	return p.rest == p.denominator;
+}
+
+
+inline void bitPool::clear()
+{
+	_bits = 0;
+	_left = 0;
+}
+
+
+template <class Engine>
+inline std::uint64_t bitPool::take(Engine& eng, unsigned count)
+{
+	if (count <= _left) {
+		const std::uint64_t bits = _bits >> (64 - count);
+		consume(count);
+		return bits;
+	}
+
+	// the pooled bits on top, then the rest from a fresh word
+	const unsigned more = count - _left;
+	const std::uint64_t high = (_left == 0) ? 0 : _bits >> (64 - _left);
+	_bits = randomWord64(eng);
+	_left = 64;
+	const std::uint64_t low = _bits >> (64 - more);
+	consume(more);
+	return (more == 64) ? low : (high << more) | low;
+}
+
+
+inline void bitPool::consume(unsigned count)
+{
+	_bits = (count == 64) ? 0 : _bits << count;
+	_left -= count;
+}
+
+
+inline std::uint64_t bitPool::deposit(std::uint64_t bits, std::uint64_t mask)
+{
+	if ((mask & (mask + 1)) == 0) {
+		// the low lanes, as in the first round: already in place
+		return bits;
+	}
+#if defined(BITPOOL_BMI2)
+	return _pdep_u64(bits, mask);
+#else
+	std::uint64_t deposited = 0;
+	for (; mask != 0; mask &= mask - 1, bits >>= 1) {
+		deposited |= (mask & (0 - mask)) & (0 - (bits & 1));
+	}
+	return deposited;
+#endif
+}
+
+
+#endif
\ No newline at end of file
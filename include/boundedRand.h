@@ -0,0 +1,155 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: boundedRand.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Header-only bounded random integer sampling shared by numMixer, tmSeer
+// and volatileSeer.
+// * Uses Lemire's nearly-divisionless method: a random word is multiplied by
+// the range and the high half of the product is the result. A division is
+// only needed in the rare case the low half falls below the range, and words
+// falling below the rejection threshold are redrawn, so results are exactly
+// uniform.
+
+// ASSUMPTIONS:
+// * Engines return uniformly distributed words starting at 0 and are either
+// 32-bit (max() == 2^32 - 1, e.g. std::mt19937) or 64-bit.
+// * 32-bit engines draw ranges below 2^32 from a single word, and larger
+// ranges from two words combined into one 64-bit word.
+// * 64-bit engines always draw from a single 64-bit word.
+// * The range must be greater than 0.
+
+
+#ifndef boundedRand_INCLUDED
+#define boundedRand_INCLUDED
+
+
+#include <cstdint>  // uint32_t, uint64_t
+
+
+inline std::uint32_t boundedThreshold(std::uint32_t range)
+{
+	return (0u - range) % range;
+}
+// DESCRIPTION:
+// * Returns the rejection threshold (2^32 - "range") % "range" for 32-bit
+// words. Words whose low product half is below it must be redrawn.
+
+
+inline std::uint64_t boundedThreshold64(std::uint64_t range)
+{
+	return (0ULL - range) % range;
+}
+// DESCRIPTION:
+// * Returns the rejection threshold (2^64 - "range") % "range" for 64-bit
+// words.
+
+
+inline std::uint64_t multiplyWide(std::uint64_t a, std::uint64_t b,
+                                  std::uint64_t& low)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ typedef unsigned __int128 uint128;
+	const uint128 product = static_cast<uint128>(a) * b;
+	low = static_cast<std::uint64_t>(product);
+	return static_cast<std::uint64_t>(product >> 64);
+#else
+	const std::uint64_t aLo = a & 0xFFFFFFFFULL;
+	const std::uint64_t aHi = a >> 32;
+	const std::uint64_t bLo = b & 0xFFFFFFFFULL;
+	const std::uint64_t bHi = b >> 32;
+	const std::uint64_t loLo = aLo * bLo;
+	const std::uint64_t hiLo = aHi * bLo;
+	const std::uint64_t loHi = aLo * bHi;
+	const std::uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFULL) + loHi;
+	low = (cross << 32) | (loLo & 0xFFFFFFFFULL);
+	return aHi * bHi + (hiLo >> 32) + (cross >> 32);
+#endif
+}
+// DESCRIPTION:
+// * Returns the high 64 bits of "a" * "b" and stores the low 64 bits into
+// "low".
+
+
+template <class Engine>
+inline std::uint32_t boundedRand32(Engine& eng, std::uint32_t range)
+{
+	std::uint64_t product = static_cast<std::uint64_t>(
+		static_cast<std::uint32_t>(eng())) * range;
+	std::uint32_t low = static_cast<std::uint32_t>(product);
+	if (low < range) {
+		const std::uint32_t threshold = boundedThreshold(range);
+		while (low < threshold) {
+			product = static_cast<std::uint64_t>(
+				static_cast<std::uint32_t>(eng())) * range;
+			low = static_cast<std::uint32_t>(product);
+		}
+	}
+	return static_cast<std::uint32_t>(product >> 32);
+}
+// DESCRIPTION:
+// * Returns a uniform random integer in [0, "range") using one 32-bit word
+// per attempt.
+//
+// PRECONDITIONS:
+// * "eng" must return 32-bit words.
+// * "range" must be greater than 0.
+
+
+template <class Engine>
+inline std::uint64_t randomWord64(Engine& eng)
+{
+	if (Engine::max() > 0xFFFFFFFFULL) {
+		return static_cast<std::uint64_t>(eng());
+	} else {
+		const std::uint64_t low = static_cast<std::uint32_t>(eng());
+		const std::uint64_t high = static_cast<std::uint32_t>(eng());
+		return (high << 32) | low;
+	}
+}
+// DESCRIPTION:
+// * Returns a 64-bit random word, combining two outputs of a 32-bit engine
+// (low half first).
+
+
+template <class Engine>
+inline std::uint64_t boundedRand64(Engine& eng, std::uint64_t range)
+{
+	std::uint64_t low = 0;
+	std::uint64_t high = multiplyWide(randomWord64(eng), range, low);
+	if (low < range) {
+		const std::uint64_t threshold = boundedThreshold64(range);
+		while (low < threshold) {
+			high = multiplyWide(randomWord64(eng), range, low);
+		}
+	}
+	return high;
+}
+// DESCRIPTION:
+// * Returns a uniform random integer in [0, "range") using one 64-bit word
+// per attempt.
+//
+// PRECONDITIONS:
+// * "range" must be greater than 0.
+
+
+template <class Engine>
+inline std::uint64_t boundedRand(Engine& eng, std::uint64_t range)
+{
+	if (Engine::max() <= 0xFFFFFFFFULL && range <= 0xFFFFFFFFULL) {
+		return boundedRand32(eng, static_cast<std::uint32_t>(range));
+	} else {
+		return boundedRand64(eng, range);
+	}
+}
+// DESCRIPTION:
+// * Returns a uniform random integer in [0, "range"), picking the cheapest
+// word width for the engine and range.
+//
+// PRECONDITIONS:
+// * "range" must be greater than 0.
+
+
+#endif
\ No newline at end of file
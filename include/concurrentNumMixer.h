@@ -0,0 +1,375 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: concurrentNumMixer.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * The shared countdown plus the quota held by every slot equals the number
+// of pings that can still succeed, once no ping is in progress.
+// * Exactly as many pings succeed, across all handles, as the countdown was
+// set to.
+// * A dataset version is only deleted once no ping that may have loaded it is
+// still in progress.
+
+// DESCRIPTION:
+// * A numMixer that many threads can ping at once. Each thread pings through
+// its own handle, which owns an independent random number stream, so draws
+// never touch shared state.
+// * The countdown is atomic. Handles lease quota from it in small chunks
+// into per-slot counters and spend their lease locally, so the shared counter
+// is only touched once per lease rather than once per ping.
+// * The dataset can be replaced wholesale while other threads ping, keeping
+// the countdown and controller state. The dataset and its parity validity are
+// published together as one immutable version, read-copy-update style: pings
+// never lock, and the replaced version is reclaimed once every ping that may
+// still be reading it has finished.
+
+// ASSUMPTIONS:
+// * The dataset, countdown range (10-20) and controller states behave as in
+// numMixer. The controller state is shared by all handles and can be changed
+// from any thread.
+// * A handle that finds its slot empty leases more quota from the countdown
+// and, once the countdown is spent, steals single pings from the other slots.
+// A ping only fails for lack of quota once every slot and the countdown are
+// empty and no lease is in flight, which keeps "exactly N successful pings"
+// exact.
+// * Slots are aligned to a cache line each. Handles are assigned slots round
+// robin; handles sharing a slot remain correct, merely contended.
+// * Handle streams are derived from a key and the handle's creation index
+// through a splitMix64 counter split, so a given seed and creation order
+// reproduce every handle's values.
+// * Pings announce themselves on one of two read-side counters in their slot,
+// picked by the parity of a global epoch. setDataset() publishes the new
+// version, then flips the epoch twice, each time waiting for the counters of
+// the previous parity to drain. Two flips are needed because a ping may have
+// read the epoch just before a flip but only announced itself after it.
+// * Handles bind their sampler to a version's dataset without taking a
+// reference, rebinding when they see a new version, so the ping path does no
+// reference counting either. An old dataset is freed with its version unless
+// a dataset() handle still shares it.
+// * setDataset() calls are serialized and block the caller, never pings, until
+// the old version is reclaimed.
+// * A handle must not outlive its concurrentNumMixer, and must only be used
+// by one thread at a time.
+// * concurrentNumMixer is an alias for basicConcurrentNumMixer<int,
+// std::mt19937>. Supported element types and engines are explicitly
+// instantiated in concurrentNumMixer.cpp.
+
+
+#ifndef concurrentNumMixer_INCLUDED
+#define concurrentNumMixer_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <atomic>  // atomic
+#include <memory>  // unique_ptr
+#include <mutex>  // mutex
+#include <random>  // mt19937
+#include <string>  // string
+#include <vector>  // vector
+
+
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+
+
+template <class T = int, class Engine = std::mt19937>
+class basicConcurrentNumMixer : public numMixerTypes
+{
+	public:
+		// Types
+
+		class handle
+		{
+			public:
+				// Constructors
+
+				handle(handle&& other) = default;
+				// DESCRIPTION:
+				// * Takes over the stream of "other".
+
+				handle(const handle&) = delete;
+				handle& operator=(const handle&) = delete;
+
+
+				// Functionality
+
+				bool ping(std::vector<T>& returnValues);
+				// DESCRIPTION:
+				// * Stores a random selection of values from the dataset into
+				// "returnValues", as numMixer::ping() does, using this
+				// handle's stream.
+				// * Returns false if the requested parity does not exist or no
+				// quota is left.
+				//
+				// POSTCONDITIONS:
+				// * If the call succeeds, one ping of quota is spent.
+
+
+			private:
+				friend class basicConcurrentNumMixer;
+
+				// Constructors
+
+				handle(basicConcurrentNumMixer& owner, std::size_t slot,
+				       std::uint64_t seed);
+				// DESCRIPTION:
+				// * Creates a handle spending quota from "slot" of "owner",
+				// drawing from a stream seeded with "seed".
+
+
+				// Members
+
+				basicConcurrentNumMixer* _owner;
+				// The concurrentNumMixer the handle pings.
+
+				std::size_t _slot;
+				// The quota slot the handle leases into.
+
+				basicNumMixer<T, Engine> _mixer;
+				// Samples the shared dataset with the handle's own stream. Its
+				// own countdown is unused.
+
+				std::uint64_t _generation;
+				// The dataset version _mixer is bound to, 0 if none.
+		};
+		// A per-thread pinging handle.
+
+
+		// Constructors
+
+		basicConcurrentNumMixer(std::size_t slots = 64);
+		// DESCRIPTION:
+		// * Samples the values 1-100, like the default numMixer.
+		// * "slots" is the number of quota slots, ideally at least the
+		// number of threads that will ping.
+		//
+		// POSTCONDITIONS:
+		// * The controller state is set to "Mix".
+		// * The countdown is randomly set to 10-20.
+
+		basicConcurrentNumMixer(basicNumDatasetHandle<T> dataset,
+		                        std::size_t slots = 64);
+		// DESCRIPTION:
+		// * Samples the shared "dataset". A null handle is treated as an
+		// empty dataset.
+		// * Otherwise behaves like the default constructor.
+
+		~basicConcurrentNumMixer();
+		// DESCRIPTION:
+		// * Releases the current dataset version.
+
+
+		// Functionality
+
+		handle makeHandle();
+		// DESCRIPTION:
+		// * Returns a new handle, with its own stream, for one thread to ping
+		// through.
+
+
+		// Accessors
+
+		bool isActive() const;
+		// DESCRIPTION:
+		// * Returns whether any ping can still succeed.
+
+		int remaining() const;
+		// DESCRIPTION:
+		// * Returns the number of pings that can still succeed, counting
+		// quota leased but not yet spent.
+		// * Exact once no ping is in progress.
+
+		int stateChangeCount() const;
+		// DESCRIPTION:
+		// * Returns how many times the output controller has changed state.
+
+		OutputController getControllerState() const;
+		// DESCRIPTION:
+		// * Returns the state of the OutputController.
+
+		std::size_t datasetSize() const;
+		// DESCRIPTION:
+		// * Returns the number of values in the dataset.
+
+		basicNumDatasetHandle<T> dataset() const;
+		// DESCRIPTION:
+		// * Returns a shared handle to the dataset.
+
+
+		// Mutators
+
+		void seed(std::uint64_t value);
+		// DESCRIPTION:
+		// * Rekeys the streams of handles created from now on, and restarts
+		// their creation index, making their values reproducible.
+
+		void setDataset(basicNumDatasetHandle<T> dataset);
+		// DESCRIPTION:
+		// * Replaces the dataset with the shared "dataset" while other
+		// threads may be pinging. A null handle is treated as an empty
+		// dataset.
+		// * Pings in progress finish on the old dataset; pings starting after
+		// the call returns sample the new one.
+		//
+		// POSTCONDITIONS:
+		// * The countdown, leased quota and controller state are unchanged.
+		// * The old version has been reclaimed.
+
+		void setControllerState(OutputController state);
+		// DESCRIPTION:
+		// * Changes the output controller to "state" if it is not already set.
+		//
+		// POSTCONDITIONS:
+		// * The state change count is incremented if the state changed.
+
+
+	private:
+		// Types
+
+		struct version
+		{
+			basicNumDatasetHandle<T> dataset;
+			bool evenValid;
+			bool oddValid;
+			std::uint64_t generation;
+		};
+		// A published dataset with its parity validity, immutable once
+		// published. Generations start at 1 and grow with every version.
+
+		struct alignas(64) quotaSlot
+		{
+			std::atomic<int> quota;
+			std::atomic<int> readers[2];
+		};
+		// Leased quota and the read-side counters of the pings using the
+		// slot, one per epoch parity, aligned and padded to a cache line so
+		// slots do not share one.
+
+
+		// Members
+
+		static const int _LEASE_SIZE = 4;
+		// The number of pings leased from the countdown at once.
+
+		std::atomic<const version*> _version;
+		// The current dataset version.
+
+		std::atomic<std::uint64_t> _epoch;
+		// Its parity picks the read-side counter new pings announce on.
+
+		std::mutex _swapLock;
+		// Serializes setDataset() calls.
+
+		std::uint64_t _generation;
+		// The generation of the newest version. Guarded by _swapLock once
+		// constructed.
+
+		std::atomic<int> _countDown;
+		// Pings not yet leased by any slot.
+
+		std::unique_ptr<char[]> _slotBuffer;
+		// Owns the slots, with room to round them up to a cache line, since
+		// new only guarantees the alignment of the fundamental types.
+
+		quotaSlot* _slots;
+		// Quota leased by the handles, within _slotBuffer.
+
+		std::size_t _slotCount;
+		// The number of slots.
+
+		std::atomic<int> _leasesInFlight;
+		// Leases taken from the countdown but not yet added to a slot.
+
+		std::atomic<std::uint64_t> _leaseCount;
+		// Counts completed leases, so a failing ping can tell whether quota
+		// moved while it was scanning.
+
+		std::atomic<int> _controllerState;
+		// Determines the parity of the values to be returned.
+
+		std::atomic<int> _stateChangeCount;
+		// Stores how many times the OutputController has changed state.
+
+		std::atomic<std::uint64_t> _key;
+		// Keys the handle streams.
+
+		std::atomic<std::uint64_t> _nextStream;
+		// The creation index of the next handle.
+
+		std::atomic<std::size_t> _nextSlot;
+		// The slot of the next handle, modulo _slotCount.
+
+
+		// Utility
+
+		void initialize(basicNumDatasetHandle<T> dataset, std::size_t slots);
+		// DESCRIPTION:
+		// * Publishes "dataset", creates the slots and sets the countdown to
+		// a random value of 10-20. Shared by every constructor.
+
+		const version* makeVersion(basicNumDatasetHandle<T> dataset);
+		// DESCRIPTION:
+		// * Returns a new version of "dataset", validated, with the next
+		// generation.
+
+		const version* enterRead(std::size_t slot, std::size_t& parity) const;
+		// DESCRIPTION:
+		// * Announces a reader on "slot" and returns the current version,
+		// which stays valid until exitRead(). Stores the counter used into
+		// "parity".
+
+		void exitRead(std::size_t slot, std::size_t parity) const;
+		// DESCRIPTION:
+		// * Withdraws a reader announced by enterRead().
+
+		void waitForReaders(std::size_t parity) const;
+		// DESCRIPTION:
+		// * Waits, yielding, until no reader is announced on the "parity"
+		// counter of any slot.
+
+		bool checkStateValid(const version& current,
+		                     OutputController state) const;
+		// DESCRIPTION:
+		// * Returns whether a ping for "state" can be evaluated on "current".
+
+		bool acquire(std::size_t slot);
+		// DESCRIPTION:
+		// * Spends one ping of quota, from "slot" if it holds any, otherwise
+		// from a new lease, otherwise stolen from another slot.
+		// * Returns false if no quota is left.
+
+		static bool takeOne(std::atomic<int>& quota);
+		// DESCRIPTION:
+		// * Decrements "quota" if it is positive and returns whether it did.
+};
+
+
+template <class T, class Engine>
+inline bool basicConcurrentNumMixer<T, Engine>::isActive() const
+{
+	return (remaining() > 0);
+}
+
+
+template <class T, class Engine>
+inline int basicConcurrentNumMixer<T, Engine>::stateChangeCount() const
+{
+	return _stateChangeCount;
+}
+
+
+template <class T, class Engine>
+inline numMixerTypes::OutputController
+basicConcurrentNumMixer<T, Engine>::getControllerState() const
+{
+	return static_cast<OutputController>(_controllerState.load());
+}
+
+
+typedef basicConcurrentNumMixer<> concurrentNumMixer;
+
+
+#endif
\ No newline at end of file
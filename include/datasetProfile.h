@@ -0,0 +1,244 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: datasetProfile.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * evenCount() + oddCount() == size(), and the histogram buckets of a
+// detailed profile sum to size().
+
+// DESCRIPTION:
+// * Summary statistics of a dataset: parity counts and minimum and maximum,
+// gathered in the same pass that ingests it, and, for a detailed profile, an
+// estimate of the number of distinct values and a coarse histogram.
+// * Profiles of disjoint blocks merge into the profile of their union, so a
+// dataset can be profiled in parallel, one block per task.
+
+// ASSUMPTIONS:
+// * Blocks are scanned in one pass. The parity count and the minimum and
+// maximum are plain reductions the compiler vectorizes, cheap enough to run
+// on every ingestion. The sketch and the histogram are updated per value
+// (a hash and a count of leading zeros each), several times the cost, so only
+// detailed profiles keep them; datasets compute theirs on first request.
+// * The profile of an arithmetic progression is computed in closed form:
+// the bounds are its ends, the distinct count is exact, and since bucketOf()
+// is monotonic each histogram bucket holds one interval of positions, found
+// by binary search.
+// * The distinct count is a HyperLogLog estimate over 1024 one-byte registers
+// (about 3% standard error), exact enough to choose between algorithms.
+// * The histogram has one bucket per sign and bit width: bucket 64 holds 0,
+// bucket 64 + w the positive values of bit width w, and bucket 63 - w the
+// negative values -2^w to -2^(w-1) - 1. Unsigned types only use buckets 64
+// and up.
+// * Values can also be added and removed one at a time, except to the
+// profile of an arithmetic progression. Counts and the histogram stay exact;
+// after removals the minimum and maximum are only bounds and the distinct
+// estimate may overcount, since neither can be updated without a rescan.
+// * datasetProfile is an alias for basicDatasetProfile<int>. Supported
+// element types are explicitly instantiated in datasetProfile.cpp.
+
+
+#ifndef datasetProfile_INCLUDED
+#define datasetProfile_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint8_t, uint64_t
+
+
+template <class T>
+class basicDatasetProfile
+{
+	public:
+		// Types
+
+		static const std::size_t BUCKETS = 129;
+		// The number of histogram buckets.
+
+
+		// Constructors
+
+		basicDatasetProfile(bool detailed = false);
+		// DESCRIPTION:
+		// * Creates the profile of an empty dataset, which also keeps the
+		// distinct sketch and the histogram if "detailed".
+
+
+		// Functionality
+
+		static basicDatasetProfile arithmetic(T start, std::size_t count,
+		                                      T stride, bool detailed);
+		// DESCRIPTION:
+		// * Returns the profile of start, start + stride, ...,
+		// start + (count - 1) * stride in closed form: O(1), or
+		// O(BUCKETS log count) if "detailed".
+		//
+		// PRECONDITIONS:
+		// * Every value must fit in a T.
+
+		void add(const T* values, std::size_t count);
+		// DESCRIPTION:
+		// * Adds the "count" values at "values" in one pass.
+
+		void add(T value);
+		// DESCRIPTION:
+		// * Adds a single value.
+
+		void remove(T value);
+		// DESCRIPTION:
+		// * Removes a single value previously added.
+		//
+		// POSTCONDITIONS:
+		// * min(), max() and distinctEstimate() are left unchanged.
+
+		void merge(const basicDatasetProfile& other);
+		// DESCRIPTION:
+		// * Adds the values profiled by "other", which must be disjoint from
+		// the values already added.
+		//
+		// PRECONDITIONS:
+		// * "other" must be detailed if this profile is.
+
+		static std::size_t bucketOf(T value);
+		// DESCRIPTION:
+		// * Returns the histogram bucket of "value".
+
+
+		// Accessors
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the number of values.
+
+		std::size_t evenCount() const;
+		// DESCRIPTION:
+		// * Returns the number of even values.
+
+		std::size_t oddCount() const;
+		// DESCRIPTION:
+		// * Returns the number of odd values.
+
+		T min() const;
+		T max() const;
+		// DESCRIPTION:
+		// * Returns the smallest/largest value.
+		//
+		// PRECONDITIONS:
+		// * The profile must not be empty.
+
+		bool detailed() const;
+		// DESCRIPTION:
+		// * Returns whether the profile keeps the distinct sketch and the
+		// histogram.
+
+		std::size_t distinctEstimate() const;
+		// DESCRIPTION:
+		// * Returns an estimate of the number of distinct values (exact for
+		// an arithmetic progression).
+		//
+		// PRECONDITIONS:
+		// * The profile must be detailed.
+
+		std::size_t bucket(std::size_t b) const;
+		// DESCRIPTION:
+		// * Returns the number of values in histogram bucket "b".
+		//
+		// PRECONDITIONS:
+		// * The profile must be detailed.
+		// * "b" must be less than BUCKETS.
+
+
+	private:
+		// Members
+
+		static const std::size_t _REGISTER_BITS = 10;
+		static const std::size_t _REGISTERS = 1 << _REGISTER_BITS;
+		// The sketch has 2^_REGISTER_BITS registers.
+
+		bool _detailed;
+		// Whether the sketch and the histogram are kept.
+
+		std::size_t _size;
+		// The number of values.
+
+		std::size_t _oddCount;
+		// The number of odd values.
+
+		T _min;
+		T _max;
+		// The smallest and largest value, if any.
+
+		std::uint8_t _registers[_REGISTERS];
+		// The HyperLogLog registers: the longest run of leading zeros (plus
+		// one) seen among the hashes routed to each register.
+
+		std::uint64_t _histogram[BUCKETS];
+		// The number of values per bucket.
+
+		std::size_t _distinct;
+		// The exact number of distinct values if known in closed form,
+		// otherwise 0 and estimated from the registers.
+
+
+		// Utility
+
+		void sketch(T value);
+		// DESCRIPTION:
+		// * Records "value" in the HyperLogLog registers.
+};
+
+
+template <class T>
+inline std::size_t basicDatasetProfile<T>::size() const
+{
+	return _size;
+}
+
+
+template <class T>
+inline std::size_t basicDatasetProfile<T>::evenCount() const
+{
+	return _size - _oddCount;
+}
+
+
+template <class T>
+inline std::size_t basicDatasetProfile<T>::oddCount() const
+{
+	return _oddCount;
+}
+
+
+template <class T>
+inline T basicDatasetProfile<T>::min() const
+{
+	return _min;
+}
+
+
+template <class T>
+inline T basicDatasetProfile<T>::max() const
+{
+	return _max;
+}
+
+
+template <class T>
+inline bool basicDatasetProfile<T>::detailed() const
+{
+	return _detailed;
+}
+
+
+template <class T>
+inline std::size_t basicDatasetProfile<T>::bucket(std::size_t b) const
+{
+	return _histogram[b];
+}
+
+
+typedef basicDatasetProfile<int> datasetProfile;
+
+
+#endif
\ No newline at end of file
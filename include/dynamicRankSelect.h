@@ -0,0 +1,168 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: dynamicRankSelect.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * Rank and select queries are valid at all times, except between setWord()
+// and the next build().
+
+// DESCRIPTION:
+// * A bitmap with rank/select support that stays queryable while bits change,
+// used to index the dataset positions of registered numMixer controllers
+// through mutations of the dataset.
+// * Costs about 1.1 bits per position, like rankSelect.
+
+// ASSUMPTIONS:
+// * Bits are grouped in blocks of 512, like rankSelect, but the number of set
+// bits per block is kept in a Fenwick (binary indexed) tree instead of a
+// cumulative directory. set(), reset() and resize() by a few bits patch the
+// tree in O(log n), so a mutation never rebuilds the directory; rank and
+// select descend the tree in O(log n) and then scan at most 8 words.
+// * A whole bitmap is loaded with setWord() and indexed by one build(), in
+// O(n / 64).
+// * select1(j) returns the position of the j-th set bit (0-based).
+
+
+#ifndef dynamicRankSelect_INCLUDED
+#define dynamicRankSelect_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <vector>  // vector
+
+
+class dynamicRankSelect
+{
+	public:
+		// Constructors
+
+		dynamicRankSelect();
+		// DESCRIPTION:
+		// * Creates an empty bitmap.
+
+		dynamicRankSelect(std::size_t size);
+		// DESCRIPTION:
+		// * Creates a bitmap of "size" unset bits.
+
+
+		// Functionality
+
+		void set(std::size_t pos);
+		void reset(std::size_t pos);
+		// DESCRIPTION:
+		// * Sets/clears the bit at "pos" in O(log n).
+		//
+		// PRECONDITIONS:
+		// * "pos" must be less than size().
+
+		void setWord(std::size_t w, std::uint64_t bits);
+		// DESCRIPTION:
+		// * Sets the bits from 64 * "w" to 64 * "w" + 63 to "bits", low bit
+		// first, without updating the counts.
+		//
+		// PRECONDITIONS:
+		// * Bits of "bits" at or past size() must be unset.
+		//
+		// POSTCONDITIONS:
+		// * build() must be called again before rank/select queries.
+
+		void resize(std::size_t size);
+		// DESCRIPTION:
+		// * Changes the number of bits to "size". Added bits are unset. Costs
+		// O(log n) plus O(log n) per block added.
+
+		void build();
+		// DESCRIPTION:
+		// * Recounts every block, in O(n / 64).
+
+		std::size_t rank1(std::size_t pos) const;
+		// DESCRIPTION:
+		// * Returns the number of set bits before "pos".
+
+		std::size_t select1(std::size_t j) const;
+		// DESCRIPTION:
+		// * Returns the position of the "j"-th set bit.
+		//
+		// PRECONDITIONS:
+		// * "j" must be less than ones().
+
+
+		// Accessors
+
+		bool test(std::size_t pos) const;
+		// DESCRIPTION:
+		// * Returns whether the bit at "pos" is set.
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the number of bits.
+
+		std::size_t ones() const;
+		// DESCRIPTION:
+		// * Returns the number of set bits.
+
+		std::size_t memoryUsage() const;
+		// DESCRIPTION:
+		// * Returns the number of bytes used by the bitmap and its tree.
+
+
+	private:
+		// Members
+
+		static const std::size_t _BLOCK_WORDS = 8;
+		// Words per block (512 bits).
+
+		std::size_t _size;
+		// The number of bits.
+
+		std::size_t _ones;
+		// The number of set bits.
+
+		std::vector<std::uint64_t> _words;
+		// The bits, 64 per word.
+
+		std::vector<std::uint64_t> _tree;
+		// The Fenwick tree over the set bits per block, 1-based: _tree[i]
+		// counts the set bits of blocks [i - (i & -i), i).
+
+
+		// Utility
+
+		void add(std::size_t block, std::int64_t delta);
+		// DESCRIPTION:
+		// * Adds "delta" to the count of "block".
+
+		std::size_t prefix(std::size_t blocks) const;
+		// DESCRIPTION:
+		// * Returns the number of set bits in the first "blocks" blocks.
+};
+
+
+inline void dynamicRankSelect::setWord(std::size_t w, std::uint64_t bits)
+{
+	_words[w] = bits;
+}
+
+
+inline bool dynamicRankSelect::test(std::size_t pos) const
+{
+	return (_words[pos >> 6] >> (pos & 63)) & 1;
+}
+
+
+inline std::size_t dynamicRankSelect::size() const
+{
+	return _size;
+}
+
+
+inline std::size_t dynamicRankSelect::ones() const
+{
+	return _ones;
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,133 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: mappedFile.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * A mappedFile either maps a whole, non-empty file read-only or maps
+// nothing.
+// * The mapping is released when the object is closed or destroyed.
+
+// DESCRIPTION:
+// * Maps a file into memory read-only so its contents can be used in place,
+// without reading or copying them.
+
+// ASSUMPTIONS:
+// * Uses mmap on POSIX systems and file mappings on Windows.
+// * PREFAULT asks the system to populate the page tables up front
+// (MAP_POPULATE on Linux, otherwise a read-ahead hint).
+// * HUGE_PAGES asks the system to back the mapping with transparent huge
+// pages where supported (MADV_HUGEPAGE). It is a hint only.
+// * Flags that the platform does not support are ignored.
+// * A mappedFile cannot be copied, but can be moved.
+
+
+#ifndef mappedFile_INCLUDED
+#define mappedFile_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <string>  // string
+
+
+class mappedFile
+{
+	public:
+		// Types
+
+		enum MapFlags { DEFAULT = 0, PREFAULT = 1, HUGE_PAGES = 2 };
+		// Flags controlling how the file is mapped. May be combined.
+
+
+		// Constructors
+
+		mappedFile();
+		// DESCRIPTION:
+		// * Creates an object that maps nothing.
+
+		mappedFile(mappedFile&& other);
+		// DESCRIPTION:
+		// * Takes over the mapping of "other".
+		//
+		// POSTCONDITIONS:
+		// * "other" maps nothing.
+
+		mappedFile& operator=(mappedFile&& other);
+		// DESCRIPTION:
+		// * Releases the current mapping and takes over the mapping of
+		// "other".
+		//
+		// POSTCONDITIONS:
+		// * "other" maps nothing.
+
+		mappedFile(const mappedFile&) = delete;
+		mappedFile& operator=(const mappedFile&) = delete;
+
+		~mappedFile();
+		// DESCRIPTION:
+		// * Releases the mapping.
+
+
+		// Functionality
+
+		bool open(const std::string& path, int flags = DEFAULT);
+		// DESCRIPTION:
+		// * Maps the file at "path" read-only, releasing any previous mapping.
+		// * Returns true if the file was mapped.
+		// * Returns false if the file could not be opened, is empty, or could
+		// not be mapped.
+
+		void close();
+		// DESCRIPTION:
+		// * Releases the mapping, if any.
+
+
+		// Accessors
+
+		bool isOpen() const;
+		// DESCRIPTION:
+		// * Returns whether a file is mapped.
+
+		const void* data() const;
+		// DESCRIPTION:
+		// * Returns the start of the mapping, or null if nothing is mapped.
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the size of the mapping in bytes.
+
+
+	private:
+		// Members
+
+		void* _data;
+		// The start of the mapping.
+
+		std::size_t _size;
+		// The size of the mapping in bytes.
+
+		void* _mapping;
+		// The file mapping handle (Windows only).
+};
+
+
+inline bool mappedFile::isOpen() const
+{
+	return (_data != nullptr);
+}
+
+
+inline const void* mappedFile::data() const
+{
+	return _data;
+}
+
+
+inline std::size_t mappedFile::size() const
+{
+	return _size;
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,624 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: numDataset.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * The values of a dataset reachable through a numDatasetHandle never
+// change. Only owned, partitioned datasets can be mutated, by their single
+// holder.
+// * evenCount() + oddCount() == size().
+
+// DESCRIPTION:
+// * Holds the integers (of element type T) a numMixer samples from, along
+// with the parity metadata needed to draw even or odd values without
+// rejection sampling.
+// * The values either live in an owned vector (copied or moved in), in
+// caller-owned memory (a borrowed view), or in a read-only memory mapping of a
+// flat binary file.
+// * Every dataset is profiled (see datasetProfile) in the same pass that
+// ingests or indexes it, so holders can consult its parity counts and bounds
+// instead of rescanning the values. The distinct estimate and histogram cost
+// more per value than ingestion itself, so they are only gathered, by a
+// parallel pass of their own, when first requested.
+
+// ASSUMPTIONS:
+// * Owned values are partitioned by parity (evens first, then odds), so each
+// parity class is a contiguous range of data().
+// * Borrowed and mapped values, and owned values that must keep their order,
+// cannot be reordered. Their parity is recorded
+// in a rank/select bitmap (about 1.1 bits per value) built by a single
+// streaming pass, and the j-th even/odd value is found with select.
+// * That pass is deferred until the parity is first needed (by the parity
+// counts, the profile, evenAt()/oddAt() or partitionedIndex()), so borrowing
+// or mapping values takes O(1), and holders that only draw from all values
+// never scan them. It runs once per dataset, under std::call_once, so a
+// dataset shared between threads is indexed by whichever holder needs it
+// first.
+// * Inputs of 2^20 values or more are ingested in parallel on a temporary
+// workerPool, in slices aligned to 64 values. Copied values are profiled in a
+// first pass and then copied straight into their partition (a stable
+// partition); moved-in values are profiled in parallel and then partitioned in
+// place; borrowed and mapped values are profiled and their parity bitmap
+// built a word at a time in the same (deferred) pass.
+// * A mapped file holds native-endian T values back to back. Trailing bytes
+// that do not form a whole value are ignored.
+// * A file that cannot be mapped produces an empty dataset.
+// * Arithmetic datasets (start, count, stride) store nothing. With an even
+// stride every value shares the parity of start; with an odd stride the
+// parity alternates, so the j-th even/odd value sits at position first + 2j.
+// Their profiles, detailed or not, are computed in closed form.
+// * Datasets are meant to be built once and shared, immutable, between any
+// number of numMixers through a numDatasetHandle.
+// * The sorted index the RANGE controller draws from (see sortedIndex) also
+// belongs to the dataset: it is built, in parallel, by the first holder that
+// asks for it, once, and shared read-only by all of them.
+// * An owned, partitioned dataset held by a single numMixer can be mutated
+// in O(1) (amortized for appends) while keeping the partition, plus the
+// cost of patching the sorted index if it was built. A mutation
+// only moves values between position i, the old and new evenCount() - 1 and
+// evenCount(), and the old and new size() - 1, so holders can patch their own
+// per-position indexes.
+// * T may be any integral type; narrow types pack more values per cache line.
+// Parity is decided by parityTraits<T>, which other types can specialize.
+// numDataset is an alias for basicNumDataset<int>. Supported element types
+// are explicitly instantiated in numDataset.cpp.
+
+
+#ifndef numDataset_INCLUDED
+#define numDataset_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <atomic>  // atomic
+#include <memory>  // shared_ptr, unique_ptr
+#include <mutex>  // call_once, once_flag
+#include <string>  // string
+#include <type_traits>  // is_integral, make_unsigned
+#include <vector>  // vector
+
+
+#include "../include/datasetProfile.h"
+#include "../include/mappedFile.h"
+#include "../include/rankSelect.h"
+#include "../include/sortedIndex.h"
+#include "../include/workerPool.h"
+
+
+template <class T>
+class parityTraits
+{
+	static_assert(std::is_integral<T>::value,
+	              "parityTraits must be specialized for non-integral types");
+
+	public:
+		// Functionality
+
+		static bool isOdd(T value);
+		// DESCRIPTION:
+		// * Returns whether "value" is odd, by testing the low bit of its
+		// unsigned representation (no sign fixup, unlike value % 2).
+		//
+		// ASSUMPTIONS:
+		// * Specialize parityTraits to sample elements of other types.
+};
+
+
+template <class T>
+class basicNumDataset
+{
+	public:
+		// Constructors
+
+		basicNumDataset();
+		// DESCRIPTION:
+		// * Creates an empty dataset.
+
+		basicNumDataset(const std::vector<T>& values);
+		// DESCRIPTION:
+		// * Copies "values" and partitions them by parity.
+
+		basicNumDataset(std::vector<T>&& values);
+		// DESCRIPTION:
+		// * Takes ownership of "values" without copying them and partitions
+		// them by parity in place.
+
+		basicNumDataset(std::vector<T>&& values,
+		                const basicDatasetProfile<T>& profile);
+		// DESCRIPTION:
+		// * Takes ownership of "values", which are already partitioned by
+		// parity and described by "profile", without copying or scanning
+		// them.
+		//
+		// PRECONDITIONS:
+		// * The first profile.evenCount() values must be even and the rest
+		// odd.
+
+		basicNumDataset(const T* data, std::size_t size);
+		// DESCRIPTION:
+		// * Borrows the "size" values at "data" without copying, reordering
+		// or scanning them. The parity bitmap is built in one pass when the
+		// parity is first needed.
+		//
+		// PRECONDITIONS:
+		// * The values must outlive the dataset and must not change.
+
+		basicNumDataset(const std::string& path,
+		                int mapFlags = mappedFile::DEFAULT);
+		// DESCRIPTION:
+		// * Maps the flat binary T file at "path". The parity bitmap is built
+		// in one streaming pass over the mapping when the parity is first
+		// needed.
+		// * "mapFlags" is passed to mappedFile::open().
+		//
+		// POSTCONDITIONS:
+		// * The dataset is empty if the file could not be mapped.
+
+		static basicNumDataset ordered(std::vector<T>&& values);
+		// DESCRIPTION:
+		// * Takes ownership of "values" without copying or reordering them,
+		// so at(i) stays the i-th value given (e.g. to line values up with
+		// per-value weights). The parity bitmap is built like a borrowed
+		// dataset's.
+
+		static basicNumDataset arithmetic(T start, std::size_t count,
+		                                  T stride = 1);
+		// DESCRIPTION:
+		// * Returns the dataset start, start + stride, ...,
+		// start + (count - 1) * stride, represented arithmetically.
+		// * Nothing is stored; every value, including the j-th even or odd
+		// one, is computed in closed form.
+		//
+		// PRECONDITIONS:
+		// * Every value must fit in a T.
+
+
+		// Functionality
+
+		std::vector<T> toVector() const;
+		// DESCRIPTION:
+		// * Returns a copy of the values in storage order.
+
+		std::vector<T> toPartitionedVector() const;
+		// DESCRIPTION:
+		// * Returns a copy of the values partitioned by parity: the evens in
+		// evenAt() order, then the odds in oddAt() order.
+
+		std::size_t partitionedIndex(std::size_t i) const;
+		// DESCRIPTION:
+		// * Returns the position of the "i"-th value in
+		// toPartitionedVector().
+		//
+		// PRECONDITIONS:
+		// * "i" must be less than size().
+
+		void append(T value);
+		// DESCRIPTION:
+		// * Adds "value" in amortized O(1), keeping the parity partition: an
+		// even value takes the place of the first odd value, which moves to
+		// the end.
+		//
+		// PRECONDITIONS:
+		// * The dataset must be contiguous() and not shared.
+
+		void remove(std::size_t i);
+		// DESCRIPTION:
+		// * Removes the "i"-th value in O(1), keeping the parity partition:
+		// the last value of its class fills the gap, and for an even value
+		// the last odd value then fills the even class's old last position.
+		//
+		// PRECONDITIONS:
+		// * The dataset must be contiguous() and not shared.
+		// * "i" must be less than size().
+
+		void update(std::size_t i, T value);
+		// DESCRIPTION:
+		// * Replaces the "i"-th value with "value" in O(1). A value that keeps
+		// its parity stays in place; otherwise it is removed and appended.
+		//
+		// PRECONDITIONS:
+		// * The dataset must be contiguous() and not shared.
+		// * "i" must be less than size().
+
+		const basicSortedIndex<T>& sortedIndex() const;
+		const basicSortedIndex<T>& sortedIndex(workerPool& pool) const;
+		// DESCRIPTION:
+		// * Returns the values in ascending order. The first call builds the
+		// index, on "pool" or on a temporary pool with one thread per
+		// hardware thread; later calls, from any holder, return it as is.
+		// * Slices of the values are copied and sorted in parallel, then
+		// merged pairwise in parallel rounds. Values whose profile spans
+		// fewer than 2^16 integers (and fewer than their count) are counting
+		// sorted instead: slices are counted in parallel and the index is
+		// written out in one pass.
+
+		bool hasSortedIndex() const;
+		// DESCRIPTION:
+		// * Returns whether the sorted index has been built.
+
+		void copySortedIndex(const basicNumDataset& other);
+		// DESCRIPTION:
+		// * Gives the dataset a copy of the sorted index of "other", if it has
+		// one, instead of sorting its own values again.
+		//
+		// PRECONDITIONS:
+		// * "other" must hold the same values.
+		// * The sorted index must not have been built.
+
+
+		// Accessors
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the number of values.
+
+		bool empty() const;
+		// DESCRIPTION:
+		// * Returns whether the dataset holds no values.
+
+		std::size_t evenCount() const;
+		// DESCRIPTION:
+		// * Returns the number of even values.
+
+		std::size_t oddCount() const;
+		// DESCRIPTION:
+		// * Returns the number of odd values.
+
+		bool contiguous() const;
+		// DESCRIPTION:
+		// * Returns whether the values are partitioned by parity, i.e. the
+		// evens are data()[0, evenCount()) and the odds follow them.
+
+		bool isMapped() const;
+		// DESCRIPTION:
+		// * Returns whether the values live in a file mapping.
+
+		bool isArithmetic() const;
+		// DESCRIPTION:
+		// * Returns whether the values are computed rather than stored.
+
+		const basicDatasetProfile<T>& profile() const;
+		// DESCRIPTION:
+		// * Returns the parity counts and bounds of the values, kept up to
+		// date by mutations (see datasetProfile for what removals leave
+		// approximate).
+
+		const basicDatasetProfile<T>& detailedProfile() const;
+		// DESCRIPTION:
+		// * Returns the detailed profile of the values, with the distinct
+		// estimate and the histogram. The first call scans the values once,
+		// in parallel (unless arithmetic); mutations then keep it up to
+		// date.
+
+		const T* data() const;
+		// DESCRIPTION:
+		// * Returns the values.
+		//
+		// PRECONDITIONS:
+		// * The dataset must not be arithmetic.
+
+		T at(std::size_t i) const;
+		// DESCRIPTION:
+		// * Returns the "i"-th value in storage order.
+
+		T evenAt(std::size_t j) const;
+		// DESCRIPTION:
+		// * Returns the "j"-th even value.
+		//
+		// PRECONDITIONS:
+		// * "j" must be less than evenCount().
+
+		T oddAt(std::size_t j) const;
+		// DESCRIPTION:
+		// * Returns the "j"-th odd value.
+		//
+		// PRECONDITIONS:
+		// * "j" must be less than oddCount().
+
+		void progression(std::uint64_t& first, std::uint64_t& step) const;
+		void evenProgression(std::uint64_t& first, std::uint64_t& step) const;
+		void oddProgression(std::uint64_t& first, std::uint64_t& step) const;
+		// DESCRIPTION:
+		// * Stores the first term and the step of the values/the even
+		// values/the odd values as a progression: the j-th is
+		// static_cast<T>("first" + j * "step"), modulo 2^64. Lets batch
+		// draws compute values with no per-value call.
+		//
+		// PRECONDITIONS:
+		// * The dataset must be arithmetic.
+
+
+	private:
+		// Types
+
+		struct deferredPasses
+		{
+			std::once_flag parity;
+			std::atomic<bool> parityDone{false};
+			std::once_flag detail;
+			std::once_flag sorted;
+			std::atomic<bool> sortedDone{false};
+		};
+		// Runs each pass deferred until first use once. The done flag lets
+		// later uses skip std::call_once with a single acquire load.
+
+
+		// Members
+
+		std::vector<T> _values;
+		// The owned values, partitioned by parity unless ordered(). Empty
+		// when borrowed or mapped.
+
+		mappedFile _mapping;
+		// The file mapping holding the values, if mapped.
+
+		const T* _external;
+		// The borrowed, mapped or order-preserving owned values, or null when
+		// the values are owned and partitioned.
+
+		std::size_t _size;
+		// The number of values.
+
+		mutable std::size_t _evenCount;
+		// The number of even values.
+
+		mutable rankSelect _parity;
+		// Marks the odd positions of values that are not partitioned. Built
+		// by the deferred parity pass.
+
+		bool _arithmetic;
+		// Whether the values are computed as _start + i * _stride.
+
+		std::uint64_t _start;
+		std::uint64_t _stride;
+		// The first value and the step between values, if arithmetic. Kept
+		// unsigned so negative strides wrap instead of overflowing.
+
+		std::size_t _evenFirst;
+		std::size_t _oddFirst;
+		std::size_t _parityStep;
+		// The first even/odd position and the distance between positions of
+		// the same parity, if arithmetic.
+
+		mutable basicDatasetProfile<T> _profile;
+		// The profile of the values.
+
+		mutable std::unique_ptr<basicDatasetProfile<T> > _detailedProfile;
+		// The detailed profile of the values, once requested.
+
+		mutable std::unique_ptr<basicSortedIndex<T> > _sortedIndex;
+		// The values in ascending order, once requested.
+
+		std::unique_ptr<deferredPasses> _deferred;
+		// The state of the deferred passes, on the heap so datasets stay
+		// movable.
+
+
+		// Utility
+
+		void partitionValues();
+		// DESCRIPTION:
+		// * Profiles the owned values and partitions them by parity in place.
+
+		void partitionFrom(const std::vector<T>& values);
+		// DESCRIPTION:
+		// * Profiles "values" and copies them into the owned values,
+		// partitioned by parity.
+
+		void requireParity() const;
+		// DESCRIPTION:
+		// * Runs the deferred parity pass if the values are external and it
+		// has not run yet.
+
+		void indexParity() const;
+		// DESCRIPTION:
+		// * Profiles the external values and builds their parity bitmap.
+
+		void profileDetails() const;
+		// DESCRIPTION:
+		// * Computes the detailed profile.
+
+		void sortValues(workerPool* pool) const;
+		// DESCRIPTION:
+		// * Builds the sorted index on "pool", or on a temporary pool if it is
+		// null.
+
+		void mergeProfiles(
+			const std::vector<basicDatasetProfile<T> >& profiles) const;
+		// DESCRIPTION:
+		// * Sets the profile to the union of the slice "profiles" and takes
+		// the even count from it.
+};
+
+
+template <class T>
+using basicNumDatasetHandle = std::shared_ptr<const basicNumDataset<T> >;
+// A reference-counted handle to an immutable dataset.
+
+typedef basicNumDataset<int> numDataset;
+typedef basicNumDatasetHandle<int> numDatasetHandle;
+
+
+template <class T>
+inline bool parityTraits<T>::isOdd(T value)
+{
+	typedef typename std::make_unsigned<T>::type unsignedType;
+	return (static_cast<unsignedType>(value) & 1u) != 0;
+}
+
+
+template <class T>
+inline std::size_t basicNumDataset<T>::size() const
+{
+	return _size;
+}
+
+
+template <class T>
+inline bool basicNumDataset<T>::empty() const
+{
+	return (_size == 0);
+}
+
+
+template <class T>
+inline std::size_t basicNumDataset<T>::evenCount() const
+{
+	requireParity();
+	return _evenCount;
+}
+
+
+template <class T>
+inline std::size_t basicNumDataset<T>::oddCount() const
+{
+	requireParity();
+	return _size - _evenCount;
+}
+
+
+template <class T>
+inline bool basicNumDataset<T>::contiguous() const
+{
+	return (_external == nullptr && !_arithmetic);
+}
+
+
+template <class T>
+inline bool basicNumDataset<T>::isMapped() const
+{
+	return _mapping.isOpen();
+}
+
+
+template <class T>
+inline bool basicNumDataset<T>::isArithmetic() const
+{
+	return _arithmetic;
+}
+
+
+template <class T>
+inline const basicDatasetProfile<T>& basicNumDataset<T>::profile() const
+{
+	requireParity();
+	return _profile;
+}
+
+
+template <class T>
+inline bool basicNumDataset<T>::hasSortedIndex() const
+{
+	return _deferred->sortedDone.load(std::memory_order_acquire);
+}
+
+
+template <class T>
+inline const basicSortedIndex<T>& basicNumDataset<T>::sortedIndex() const
+{
+	if (!hasSortedIndex()) {
+		std::call_once(_deferred->sorted, &basicNumDataset::sortValues, this,
+		               nullptr);
+	}
+	return *_sortedIndex;
+}
+
+
+template <class T>
+inline const basicSortedIndex<T>& basicNumDataset<T>::sortedIndex(
+	workerPool& pool) const
+{
+	if (!hasSortedIndex()) {
+		std::call_once(_deferred->sorted, &basicNumDataset::sortValues, this,
+		               &pool);
+	}
+	return *_sortedIndex;
+}
+
+
+template <class T>
+inline const T* basicNumDataset<T>::data() const
+{
+	return _external ? _external : _values.data();
+}
+
+
+template <class T>
+inline T basicNumDataset<T>::at(std::size_t i) const
+{
+	if (_arithmetic) {
+		return static_cast<T>(_start + static_cast<std::uint64_t>(i) * _stride);
+	} else {
+		return data()[i];
+	}
+}
+
+
+template <class T>
+inline T basicNumDataset<T>::evenAt(std::size_t j) const
+{
+	if (contiguous()) {
+		return _values[j];
+	} else if (_arithmetic) {
+		return at(_evenFirst + j * _parityStep);
+	} else {
+		requireParity();
+		return _external[_parity.select0(j)];
+	}
+}
+
+
+template <class T>
+inline T basicNumDataset<T>::oddAt(std::size_t j) const
+{
+	if (contiguous()) {
+		return _values[_evenCount + j];
+	} else if (_arithmetic) {
+		return at(_oddFirst + j * _parityStep);
+	} else {
+		requireParity();
+		return _external[_parity.select1(j)];
+	}
+}
+
+
+template <class T>
+inline void basicNumDataset<T>::progression(std::uint64_t& first,
+                                            std::uint64_t& step) const
+{
+	first = _start;
+	step = _stride;
+}
+
+
+template <class T>
+inline void basicNumDataset<T>::evenProgression(std::uint64_t& first,
+                                                std::uint64_t& step) const
+{
+	first = _start + static_cast<std::uint64_t>(_evenFirst) * _stride;
+	step = static_cast<std::uint64_t>(_parityStep) * _stride;
+}
+
+
+template <class T>
+inline void basicNumDataset<T>::oddProgression(std::uint64_t& first,
+                                               std::uint64_t& step) const
+{
+	first = _start + static_cast<std::uint64_t>(_oddFirst) * _stride;
+	step = static_cast<std::uint64_t>(_parityStep) * _stride;
+}
+
+
+template <class T>
+inline void basicNumDataset<T>::requireParity() const
+{
+	if (_external
+	    && !_deferred->parityDone.load(std::memory_order_acquire)) {
+		std::call_once(_deferred->parity, &basicNumDataset::indexParity, this);
+	}
+}
+
+
+#endif
\ No newline at end of file
@@ -7,32 +7,47 @@
 // DESCRIPTION:
 // * This class outputs a random set of integers selected either from user
 // seeded input, or from an auto-generated set.
-// * This class can be placed into an illegal state should the user provide a
-// vector of size zero on object creation.
+// * Pings fail should the dataset be empty (a vector of size zero, or a file
+// that could not be mapped).
 // * Or should the user request a parity they did not provide (i.e. even
 // numbers when they did not provide even numbers).
 // * This class is anticipated to be used as a data sink.
 
 // ASSUMPTIONS: 
-// * This class has one hard requirement for correct usage: the user MUST
-// provide a vector of size > 0 or else the program can fail. Otherwise, this
-// class protects against invalid states (i.e. requesting even/odd numbers when
-// the user hasn't provided any).
-// * This class will build its dataset either from a user provided vector, or
-// from a pre-defined, valid vector. The vector must be size > 0, and should
-// have even and odd numbers if the user wishes to ping them.
+// * This class protects against invalid states (i.e. requesting even/odd
+// numbers when the user hasn't provided any, or pinging an empty dataset).
+// * This class will build its dataset either from a user provided vector, a
+// user provided binary file, or from a pre-defined, valid vector. The dataset
+// should be size > 0, and should have even and odd numbers if the user wishes
+// to ping them.
 // * The user can change the output controller via a public mutator.
 // * The state change counter will only increment should the state ACTUALLY
 // change.
 // * To ping the numMixer, the user must provide a vector of the size they
 // want returned. The class protects against vectors of size = 0. Pinging the
-// numMixer can fail (return false) in two cases:
+// numMixer can fail (return false) in three cases:
 //   1. The numMixer is inactive.
 //   2. The user has requested even/odd integers when they did not provide any.
+//   3. The dataset is empty.
 // * The numMixer returns integers by randomly selecting them from the set
-// provided at object creation. It randomly selects indexes from the vector
-// until it finds a valid number (e.g. an even number if the controller is set
-// to even) and stores them in a user provided vector.
+// provided at object creation and stores them in a user provided vector (or
+// a buffer, output iterator, sink or generator, see ping()).
+// * Every draw is uniform over the values matching the output controller
+// (MIX, EVEN, ODD, RANGE or a registered controller), or proportional to
+// the weights for WEIGHTED, and never rejects a value.
+// * Until the dataset is first mutated, every draw costs O(1). After it,
+// draws from RANGE and registered controllers cost O(log n), and each
+// mutation costs O(log n) plus one block shift of the range index.
+// * A ping returns the same values as calling genRandNum() once per element
+// with the same seed. Parallel pings depend only on the seed, not on the
+// number of threads.
+// * A dataset that is shared, borrowed, mapped or computed is never written:
+// the numMixer copies it first (copy on write).
+// * The element type T may be any integral type (int8_t through uint64_t)
+// (parity is decided by parityTraits<T>, see numDataset.h) and the engine
+// any engine from rngEngines.h or std::mt19937. numMixer is
+// basicNumMixer<int, std::mt19937>. Supported combinations are explicitly
+// instantiated in numMixer.cpp.
 // * The "active" state of the numMixer is tracked via a counter which is
 // randomly set at object creation. It is decremented everytime the user
 // successfully pings the numMixer.
@@ -44,26 +59,161 @@
 #define numMixer_INCLUDED
 
 
+#include <cstddef>  // size_t, ptrdiff_t
+#include <cstdint>  // uint32_t, uint64_t
+#include <algorithm>  // copy, min
+#include <functional>  // function
+#include <iterator>  // input_iterator_tag
 #include <vector>  // vector
 #include <random>  // mt19937
 #include <string>  // string
 
 
-class numMixer
+#include "../include/aliasTable.h"
+#include "../include/dynamicRankSelect.h"
+#include "../include/mappedFile.h"
+#include "../include/numDataset.h"
+#include "../include/rankSelect.h"
+#include "../include/rngEngines.h"
+#include "../include/workerPool.h"
+
+
+class numMixerTypes
 {
 	public:
 		// Types
 
-		enum OutputController { MIX, EVEN, ODD };
-		// Valid states the output controller can be set to.
+		enum OutputController : int {
+			MIX, EVEN, ODD, WEIGHTED, RANGE, FIRST_CUSTOM
+		};
+		// Valid states the output controller can be set to. Shared by every
+		// engine instantiation of basicNumMixer. WEIGHTED draws values in
+		// proportion to their weights, RANGE draws values within the range
+		// set by setRange(). Registered controllers are numbered from
+		// FIRST_CUSTOM up, in registration order.
+};
+
+
+template <class T, class Engine>
+class basicConcurrentNumMixer;
+
+
+template <class T, class Engine>
+class basicPrefillNumMixer;
+
+
+template <class T = int, class Engine = std::mt19937>
+class basicNumMixer : public numMixerTypes
+{
+	public:
+		// Types
+
+		class generator
+		{
+			public:
+				// Types
+
+				class iterator
+				{
+					public:
+						// Types
+
+						typedef std::input_iterator_tag iterator_category;
+						typedef T value_type;
+						typedef std::ptrdiff_t difference_type;
+						typedef const T* pointer;
+						typedef const T& reference;
+
+
+						// Constructors
+
+						iterator(generator* source = nullptr);
+						// DESCRIPTION:
+						// * Creates an iterator over "source", or the end
+						// iterator.
+
+
+						// Functionality
+
+						const T& operator*() const;
+						iterator& operator++();
+						bool operator==(const iterator& other) const;
+						bool operator!=(const iterator& other) const;
+
+
+					private:
+						// Members
+
+						generator* _source;
+						// The generator read from, or null for the end.
+				};
+				// A single-pass input iterator over the generated values.
+
+
+				// Constructors
+
+				generator();
+				// DESCRIPTION:
+				// * Creates a generator that yields nothing.
+
+
+				// Functionality
+
+				iterator begin();
+				iterator end();
+				// DESCRIPTION:
+				// * Return the single-pass range of values still to come.
+
+
+				// Accessors
+
+				std::size_t remaining() const;
+				// DESCRIPTION:
+				// * Returns the number of values still to come.
+
+
+			private:
+				friend class basicNumMixer;
+
+
+				// Members
+
+				static const std::size_t _BLOCK_SIZE = 64;
+				// Values drawn at once.
+
+				basicNumMixer* _mixer;
+				// The numMixer the values are drawn from.
+
+				std::size_t _undrawn;
+				// Values not drawn yet.
+
+				T _block[_BLOCK_SIZE];
+				// The values drawn most recently.
+
+				std::size_t _next;
+				std::size_t _filled;
+				// The next value of _block to yield and the number drawn
+				// into it.
+
+
+				// Utility
+
+				void refill();
+				// DESCRIPTION:
+				// * Draws the next block of values if _block is used up.
+		};
+		// A lazy range of pinged values, drawn in small blocks as they are
+		// read. Filled by ping(count, generator&).
 
 
 		// Constructors
 
-		numMixer();
+		basicNumMixer();
 		// Description:
 		// * The no-arg constructor creates a dataset to choose from of values
 		// 1-100.
+		// * The values are computed rather than stored, and shared by every
+		// default-constructed numMixer.
 		// * Calls for integers of any parity are valid.
 		// * The numMixer can be called a randomly selected amount of times,
 		// 10-20.
@@ -77,7 +227,7 @@ class numMixer
 		// * Calls for integers of even parity are valid.
 		// * Calls for integers of odd parity are valid.
 
-		numMixer(std::vector<int>& dataset);
+		basicNumMixer(std::vector<T>& dataset);
 		// Description:
 		// * This constructor creates a dataset using "dataset".
 		// * The validity of various parity calls are evaluated on the dataset
@@ -99,10 +249,92 @@ class numMixer
 		// * Calls for integers of even parity may or may not be valid.
 		// * Calls for integers of odd parity may or may not be valid.
 
+		basicNumMixer(std::vector<T>&& dataset);
+		// Description:
+		// * This constructor takes ownership of "dataset" without copying it.
+		// The values are partitioned by parity in place.
+		// * Otherwise behaves like the copying constructor.
+		//
+		// Postconditions:
+		// * "dataset" is left empty.
+
+		basicNumMixer(const T* data, std::size_t size);
+		// Description:
+		// * This constructor samples from the "size" integers at "data"
+		// without copying, reordering or scanning them (a borrowed view).
+		// * The parity of the values is indexed by a compact rank/select
+		// bitmap, built by a single pass over them on the first EVEN or ODD
+		// use. Several numMixers should share one borrowed dataset through a
+		// numDatasetHandle instead, so it is only indexed once.
+		// * Otherwise behaves like the copying constructor.
+		//
+		// Preconditions:
+		// * The values must outlive the numMixer and must not change while it
+		// exists.
+
+		basicNumMixer(const std::string& path,
+		              int mapFlags = mappedFile::DEFAULT);
+		// Description:
+		// * This constructor memory maps the flat binary T file at "path"
+		// and samples straight from the mapping, without copying it.
+		// * The parity of the values is indexed by a single streaming pass
+		// over the mapping on the first EVEN or ODD use.
+		// * "mapFlags" may request prefaulted pages (mappedFile::PREFAULT)
+		// and/or huge pages (mappedFile::HUGE_PAGES).
+		// * The numMixer can be called a randomly selected amount of times,
+		// 10-20, before transitioning to inactive.
+		// * The output controller defaults to "Mix".
+		//
+		// Preconditions:
+		// * The file must hold native-endian T values.
+		// * The file must not change while the numMixer exists.
+		//
+		// Postconditions:
+		// * The controller state is set to "Mix".
+		// * The state change count is set to 0.
+		// * The dataset is the mapped file. If it could not be mapped, the
+		// dataset is empty and every ping fails.
+		// * The countdown is randomly set to 10-20.
+
+
+		basicNumMixer(const std::vector<T>& values,
+		              const std::vector<double>& weights);
+		// Description:
+		// * This constructor samples from "values", where the WEIGHTED
+		// controller draws "values"[i] in proportion to "weights"[i] through
+		// an alias table.
+		// * An empty "weights" derives the weights from duplicate counts:
+		// each distinct value is stored once, in ascending order, weighted by
+		// how often it occurs in "values".
+		// * The values keep their order (see numDataset::ordered()), so
+		// setWeight() indexes match "values", or the ascending distinct
+		// values. MIX, EVEN and ODD draw uniformly from the stored values.
+		// * Otherwise behaves like the copying constructor.
+		//
+		// Preconditions:
+		// * "weights" must be empty or the size of "values", and hold finite,
+		// non-negative weights.
+		//
+		// Postconditions:
+		// * If "weights" is invalid, WEIGHTED pings fail.
+
+		basicNumMixer(basicNumDatasetHandle<T> dataset);
+		// Description:
+		// * This constructor samples from a shared, immutable dataset built
+		// once (see numDataset) along with its parity metadata.
+		// * Any number of numMixers, with different engines, seeds and
+		// controller states, can share one dataset; memory grows with the
+		// number of distinct datasets rather than the number of numMixers.
+		// * Otherwise behaves like the copying constructor.
+		//
+		// Postconditions:
+		// * The dataset is shared, not copied. A null handle is treated as an
+		// empty dataset.
+
 
 		// Functionality
 
-		virtual bool ping(std::vector<int>& returnValues);
+		virtual bool ping(std::vector<T>& returnValues);
 		// Description:
 		// * Stores a random selection of integers from the dataset into
 		// "returnValues".
@@ -123,6 +355,72 @@ class numMixer
 		// Postconditions:
 		// * If the call succeeds, the countdown is decremented.
 
+		bool ping(T* values, std::size_t count);
+		// Description:
+		// * Like ping(), but stores "count" values into the caller's buffer
+		// at "values", which need not be a vector or be initialized.
+		//
+		// Preconditions:
+		// * "values" must point to at least "count" writable values.
+
+		template <class OutputIterator>
+		bool ping(OutputIterator out, std::size_t count);
+		// Description:
+		// * Like ping(), but writes "count" values through "out" (e.g. a
+		// back_inserter or ostream_iterator), in blocks of 256 drawn into a
+		// stack buffer.
+
+		bool ping(std::size_t count,
+		          const std::function<void(const T*, std::size_t)>& sink);
+		// Description:
+		// * Like ping(), but hands the "count" values to "sink" in blocks of
+		// up to 256 (a pointer and a length), e.g. to stream them into a
+		// socket, a file or a reduction without an intermediate buffer.
+
+		bool ping(std::size_t count, generator& values);
+		// Description:
+		// * Like ping(), but returns the "count" values lazily: "values"
+		// yields them as it is iterated, drawing 64 at a time.
+		// * The checks and the countdown happen now; the values are drawn
+		// with the controller state current when they are read.
+		//
+		// Preconditions:
+		// * The numMixer must outlive the iteration, and its controller
+		// state and dataset must not change while "values" is read.
+
+		bool pingUnique(std::vector<T>& returnValues);
+		// Description:
+		// * Like ping(), but the values are drawn without replacement: every
+		// value stored comes from a different dataset element (equal values
+		// stored more than once in the dataset can still repeat).
+		// * Respects the EVEN/ODD controller, drawing from the matching
+		// parity only.
+		// * Uses a sparse partial Fisher-Yates shuffle that only records the
+		// displaced positions, so it takes O(k) time and memory for k values
+		// and never copies the dataset.
+		// * Returns false if the numMixer is inactive, the requested parity
+		// does not exist, the controller is WEIGHTED, or "returnValues" is
+		// larger than the number of eligible elements.
+		//
+		// Postconditions:
+		// * If the call succeeds, the countdown is decremented.
+
+		bool ping(std::vector<T>& returnValues, workerPool& pool);
+		// Description:
+		// * Like ping(), but fills "returnValues" in parallel on "pool".
+		// * The output is split into fixed-size chunks. Each chunk draws from
+		// its own stream, seeded from one word of the numMixer's generator and
+		// the chunk's index (a splitMix64 counter split), so the result only
+		// depends on the seed: it is the same for any pool size.
+		// * The values differ from those a single-threaded ping would return
+		// for the same seed.
+		//
+		// Preconditions:
+		// * Same as ping().
+		//
+		// Postconditions:
+		// * If the call succeeds, the countdown is decremented once.
+
 
 		// Accessors
 
@@ -144,9 +442,23 @@ class numMixer
 		// Description:
 		// * Returns the name of the controller state, for templating purposes.
 
+		std::size_t datasetSize() const;
+		// Description:
+		// * Returns the number of values in the dataset.
+
+		basicNumDatasetHandle<T> dataset() const;
+		// Description:
+		// * Returns a shared handle to the dataset, e.g. to build more
+		// numMixers over the same values.
+
 
 		// Mutators
 
+		void seed(std::uint64_t value);
+		// Description:
+		// * Reseeds the random number generator with "value", making the
+		// values returned by subsequent pings reproducible.
+
 		void setControllerState(OutputController state);
 		// Description:
 		// * Changes the output controller to "state" if it is not already set.
@@ -158,11 +470,118 @@ class numMixer
 		// Postconditions:
 		// * The output controller changes state.
 
+		bool setControllerState(const std::string& name);
+		// Description:
+		// * Changes the output controller to the built-in or registered
+		// controller called "name".
+		// * Returns false, changing nothing, if no controller has that name.
+
+		bool addResidueController(const std::string& name,
+		                          std::uint64_t modulus,
+		                          std::uint64_t residue);
+		// Description:
+		// * Registers a controller called "name" that draws the values
+		// congruent to "residue" modulo "modulus" (negative values use the
+		// non-negative residue, e.g. -1 mod 3 == 2).
+		// * The matching dataset elements are indexed once, here, by a
+		// rank/select bitmap, so draws take O(1) without rejection (O(log n)
+		// once the dataset has been mutated).
+		// * Returns false if "name" is empty or taken, or "modulus" is 0.
+		//
+		// Postconditions:
+		// * The controller is selected with setControllerState("name") or
+		// its number (FIRST_CUSTOM + registration index).
+
+		bool addPredicateController(const std::string& name,
+		                            const std::function<bool(T)>& predicate);
+		// Description:
+		// * Registers a controller called "name" that draws the values for
+		// which "predicate" returns true, indexed like a residue controller.
+		// * Returns false if "name" is empty or taken.
+		//
+		// Preconditions:
+		// * "predicate" must be deterministic.
+
+		void buildRangeIndex();
+		void buildRangeIndex(workerPool& pool);
+		// Description:
+		// * Enables the RANGE controller, which draws from the dataset's
+		// sorted index (see numDataset::sortedIndex()).
+		// * The index is built on "pool", or on one thread per hardware
+		// thread, unless another holder of the dataset already built it.
+		//
+		// Postconditions:
+		// * Any previous range is cleared.
+
+		bool setRange(T low, T high);
+		// Description:
+		// * Sets the output controller to RANGE, drawing the dataset values
+		// within ["low", "high"].
+		// * Binary searches the sorted index once, in O(log n); each value is
+		// then a single uniform draw from the eligible slice.
+		// * Returns false, changing nothing, if the range index has not been
+		// built or "low" > "high".
+		//
+		// Postconditions:
+		// * Pings fail while no dataset value lies within the range.
+
+		bool setWeight(std::size_t i, double weight);
+		// Description:
+		// * Changes the weight of the "i"-th weighted value.
+		// * Updates are O(1); the alias table is rebuilt once, by the next
+		// weighted draw, however many weights changed.
+		// * Returns false, changing nothing, if the numMixer has no weights,
+		// "i" is out of range or "weight" is negative or not finite.
+
+		bool append(T value);
+		// Description:
+		// * Adds "value" to the dataset: amortized O(1) for the parity
+		// partition, O(log n) per controller and a block shift for the
+		// range index.
+		// * The parity partition and validity, registered controllers and
+		// the range index are updated incrementally (see datasetChanged()).
+		// * Returns false, changing nothing, if the numMixer has weights.
+		//
+		// Postconditions:
+		// * A shared, borrowed, mapped or arithmetic dataset is first copied
+		// into a private, partitioned one (copy on write), which may
+		// renumber positions.
+
+		bool remove(std::size_t i);
+		// Description:
+		// * Removes the value at position "i" of dataset(), at the same cost
+		// as append(). The last value of its parity class takes its place.
+		// * Returns false, changing nothing, if the numMixer has weights or
+		// "i" is out of range.
+		//
+		// Postconditions:
+		// * Same as append().
+
+		bool update(std::size_t i, T value);
+		// Description:
+		// * Replaces the value at position "i" of dataset() with "value", at
+		// the same cost as append(). A value changing parity moves to the end
+		// of its new class.
+		// * Returns false, changing nothing, if the numMixer has weights or
+		// "i" is out of range.
+		//
+		// Postconditions:
+		// * Same as append().
+
+		bool setDataset(basicNumDatasetHandle<T> dataset);
+		// Description:
+		// * Replaces the whole dataset with the shared "dataset", keeping the
+		// countdown, output controller, state change count and stream. A
+		// null handle is treated as an empty dataset.
+		// * Registered controllers are re-evaluated over the new values, and
+		// the range index, if built, is rebuilt keeping the current range.
+		// * Returns false, changing nothing, if the numMixer has weights.
+
 
 	protected:
 		// Utility
 
-		int genRandNum();
+		T genRandNum();
 		// Description:
 		// * Selects random values from the dataset and returns them depending
 		// on the state of the output controller.
@@ -170,14 +589,83 @@ class numMixer
 		// Preconditions:
 		// * The dataset must be of size > 0.
 		// * The dataset must contain numbers of the requested parity.
+
+		void genRandNums(T* values, std::size_t count);
+		// Description:
+		// * Stores "count" random values from the dataset into "values",
+		// depending on the state of the output controller.
+		// * Produces the same values as "count" calls to genRandNum().
+		//
+		// Preconditions:
+		// * "values" must point to at least "count" integers.
+		// * The dataset must be of size > 0.
+		// * The dataset must contain numbers of the requested parity.
+
+		void drawValues(wordEngine<Engine>& eng, T* values,
+		                std::size_t count) const;
+		// Description:
+		// * Stores "count" random values drawn with "eng" into "values".
+		// * Random indexes are generated in blocks by the vectorized
+		// (AVX2/SSE2, scalar fallback) bounded-integer kernel and then
+		// gathered from the dataset. The kernel consumes the engine exactly
+		// as repeated single draws would. Defining NUMMIXER_NO_SIMD forces
+		// the scalar kernel. Gathers from partitions larger
+		// than 4 MiB prefetch 32 indexes ahead, hiding memory latency without
+		// changing the values or their order.
+		// * Does not modify the numMixer, so several threads can draw with
+		// their own engines at once.
+		//
+		// Preconditions:
+		// * Same as genRandNums().
 		
 		bool checkStateValid() const;
 		// Description:
 		// * Checks whether a ping call is valid depending on the output
 		// controller state.
+		// * Calls are never valid on an empty dataset.
 		// * Returns true if the call is valid.
 		// * Returns false if the call is invalid.
 
+		basicNumDataset<T>& mutableDataset();
+		// Description:
+		// * Returns the dataset for modification, copying it first unless
+		// this numMixer is its only holder and owns its values (copy on
+		// write).
+		//
+		// Postconditions:
+		// * The dataset is owned privately by this numMixer.
+
+		void initialize();
+		// Description:
+		// * Seeds the random number generator and sets the countdown to a
+		// random value of 10-20. Shared by every constructor.
+
+		std::size_t controllerSize() const;
+		// Description:
+		// * Returns how many dataset values match the output controller
+		// state.
+
+		const T* controllerPartition() const;
+		// Description:
+		// * Returns the contiguous run of dataset values matching the output
+		// controller state, or null if they are not stored contiguously.
+
+		T controllerValue(std::size_t j) const;
+		// Description:
+		// * Returns the "j"-th dataset value matching the output controller
+		// state.
+		//
+		// Preconditions:
+		// * "j" must be less than controllerSize().
+
+		bool controllerProgression(std::uint64_t& first,
+		                           std::uint64_t& step) const;
+		// Description:
+		// * If the dataset values matching the output controller state are
+		// computed (MIX, EVEN or ODD over an arithmetic dataset), stores
+		// their progression (see numDataset) and returns true. Otherwise
+		// returns false.
+
 
 		// Members
 
@@ -189,42 +677,255 @@ class numMixer
 
 
 	private:
-		// Members
+		friend class basicConcurrentNumMixer<T, Engine>;
+		friend class basicPrefillNumMixer<T, Engine>;
+		// Their handles and producers sample through genRandNums() without a
+		// countdown.
+
+
+		// Types
 
-		bool _evenValid;
-		// Determines whether pings for even values can be evaluated.
+		struct controller
+		{
+			std::string name;
+			std::function<bool(T)> predicate;
+			rankSelect members;
+			dynamicRankSelect patched;
+			bool mutated;
+
+			std::size_t ones() const
+			{
+				return mutated ? patched.ones() : members.ones();
+			}
+
+			std::size_t select1(std::size_t j) const
+			{
+				return mutated ? patched.select1(j) : members.select1(j);
+			}
+		};
+		// A registered controller: its name, its predicate, and the bitmap of
+		// dataset positions whose value satisfies it. "members" is static,
+		// built in one pass, and selects in O(1) through its hints. The first
+		// mutation of the dataset copies it into "patched", whose Fenwick
+		// counts absorb later mutations in O(log n) at the price of an
+		// O(log n) select; indexing the controller again returns to
+		// "members".
 
-		bool _oddValid;
-		// Determines whether pings for odd values can be evaluated.
 
-		std::vector<int> _dataset;
-		// Stores the values to be randomly returned in pings.
+		// Members
 
-		std::mt19937 _eng;
+		basicNumDatasetHandle<T> _dataset;
+		// Stores the values to be randomly returned in pings, along with
+		// their parity metadata. May be shared with other numMixers.
+		// Owned values are partitioned by parity (evens first, then odds),
+		// so an EVEN or ODD draw is one bounded index into its partition.
+		// Borrowed and mapped values are sampled in place; their parity
+		// classes are indexed by a rank/select bitmap, built on the first
+		// EVEN or ODD use. numMixers sharing one handle index them once:
+		//     numDatasetHandle handle =
+		//         std::make_shared<const numDataset>(data, n);
+		//     numMixer a(handle), b(handle);
+
+		bool _datasetPrivate;
+		// Whether _dataset was created by this numMixer (as opposed to being
+		// handed in by the user), which copy on write needs to know.
+
+		wordEngine<Engine> _eng;
 		// Used to seed the dataset, countDown, and randomly select values from
-		// the dataset.
+		// the dataset. Hands out 32-bit words regardless of the engine's
+		// output width.
 
 		OutputController _controllerState;
 		// Determines the parity of the integers to be returned.
+
+		aliasTable _weights;
+		// Draws dataset positions in proportion to their weights for the
+		// WEIGHTED controller. Empty unless weights were given.
+
+		std::vector<controller> _controllers;
+		// The registered controllers, numbered from FIRST_CUSTOM.
+
+		bool _rangeIndexed;
+		// Whether buildRangeIndex() has been called.
+
+		bool _rangeSet;
+		// Whether setRange() has been called since the index was built.
+
+		T _rangeLow;
+		T _rangeHigh;
+		// The current range, if set.
+
+		std::size_t _rangeBegin;
+		std::size_t _rangeEnd;
+		// The positions of the dataset's sorted index within the current
+		// range. Found by one binary search per range; a draw is then one
+		// uniform position, read in O(1) (O(log n) once the index has been
+		// patched, see sortedIndex).
+
+
+		// Utility
+
+		bool addController(const std::string& name,
+		                   const std::function<bool(T)>& predicate);
+		// Description:
+		// * Registers a controller, building its bitmap in one pass over the
+		// dataset. Returns false if "name" is empty or taken.
+
+		const controller* customController() const;
+		// Description:
+		// * Returns the registered controller the output controller is set
+		// to, or null for built-in (or unknown) states.
+
+		void indexController(controller& custom);
+		// Description:
+		// * Rebuilds "custom"'s bitmap from scratch, in one pass over the
+		// dataset.
+
+		void datasetChanged(std::size_t oldEvenCount, std::size_t oldSize,
+		                    std::size_t i);
+		// Description:
+		// * Brings every structure derived from the dataset up to date after
+		// a mutation at position "i": parity validity, the registered
+		// controllers' bits at the positions the mutation can have moved,
+		// and the current range slice.
+		// * The parity partition moves at most two values, so only "i", the
+		// old and new parity boundaries and the old and new last positions
+		// are re-evaluated per controller, in O(log n) each.
+
+		void locateRange();
+		// Description:
+		// * Binary searches the dataset's sorted index for the positions
+		// within the current range, which are empty if no range is set.
 };
 
 
-inline bool numMixer::isActive() const
+template <class T, class Engine>
+inline bool basicNumMixer<T, Engine>::isActive() const
 {
 	return (_countDown > 0);
 }
 
 
-inline int numMixer::stateChangeCount() const
+template <class T, class Engine>
+inline int basicNumMixer<T, Engine>::stateChangeCount() const
 {
 	return _stateChangeCount;
 }
 
 
-inline numMixer::OutputController numMixer::getControllerState() const
+template <class T, class Engine>
+inline std::size_t basicNumMixer<T, Engine>::datasetSize() const
+{
+	return _dataset->size();
+}
+
+
+template <class T, class Engine>
+inline basicNumDatasetHandle<T>
+basicNumMixer<T, Engine>::dataset() const
+{
+	return _dataset;
+}
+
+
+template <class T, class Engine>
+inline numMixerTypes::OutputController
+basicNumMixer<T, Engine>::getControllerState() const
 {
 	return _controllerState;
 }
 
 
+template <class T, class Engine>
+template <class OutputIterator>
+bool basicNumMixer<T, Engine>::ping(OutputIterator out, std::size_t count)
+{
+	if (isActive() && checkStateValid()) {
+		const std::size_t BLOCK_SIZE = 256;
+		T block[BLOCK_SIZE];
+		for (std::size_t done = 0; done < count; ) {
+			const std::size_t drawn = std::min(BLOCK_SIZE, count - done);
+			genRandNums(block, drawn);
+			out = std::copy(block, block + drawn, out);
+			done += drawn;
+		}
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+
+template <class T, class Engine>
+inline typename basicNumMixer<T, Engine>::generator::iterator
+basicNumMixer<T, Engine>::generator::begin()
+{
+	refill();
+	return iterator(this);
+}
+
+
+template <class T, class Engine>
+inline typename basicNumMixer<T, Engine>::generator::iterator
+basicNumMixer<T, Engine>::generator::end()
+{
+	return iterator();
+}
+
+
+template <class T, class Engine>
+inline std::size_t basicNumMixer<T, Engine>::generator::remaining() const
+{
+	return _undrawn + (_filled - _next);
+}
+
+
+template <class T, class Engine>
+inline basicNumMixer<T, Engine>::generator::iterator::iterator(
+	generator* source):
+	_source(source)
+{
+}
+
+
+template <class T, class Engine>
+inline const T& basicNumMixer<T, Engine>::generator::iterator::operator*()
+	const
+{
+	return _source->_block[_source->_next];
+}
+
+
+template <class T, class Engine>
+inline typename basicNumMixer<T, Engine>::generator::iterator&
+basicNumMixer<T, Engine>::generator::iterator::operator++()
+{
+	++_source->_next;
+	_source->refill();
+	return *this;
+}
+
+
+template <class T, class Engine>
+inline bool basicNumMixer<T, Engine>::generator::iterator::operator==(
+	const iterator& other) const
+{
+	const bool done = !_source || _source->remaining() == 0;
+	const bool otherDone = !other._source || other._source->remaining() == 0;
+	return (done && otherDone) || (!done && _source == other._source);
+}
+
+
+template <class T, class Engine>
+inline bool basicNumMixer<T, Engine>::generator::iterator::operator!=(
+	const iterator& other) const
+{
+	return !(*this == other);
+}
+
+
+typedef basicNumMixer<> numMixer;
+
+
 #endif
\ No newline at end of file
@@ -37,10 +37,12 @@
 #define numMixerTmVolatileSeer_INCLUDED
 
 
+#include <cstddef>  // size_t
 #include <vector>  // vector
 #include <string>  // string
 
 
+#include "../include/numDataset.h"
 #include "../include/numMixer.h"
 #include "../include/tmVolatileSeer.h"
 
@@ -71,6 +73,25 @@ class numMixerTmVolatileSeer : public numMixer, public tmVolatileSeer
 		// * q is passed to seer and tmVolatileSeer's constructors.
 		// * dataset is passed to numMixer's constructor.
 
+		numMixerTmVolatileSeer(int q, std::vector<int>&& dataset);
+		// * Same as above, but moves "dataset" into numMixer instead of
+		// copying it.
+		//
+		// POSTCONDITIONS:
+		// * "dataset" is left empty.
+
+		numMixerTmVolatileSeer(int q, const int* data, std::size_t size);
+		// * Same as above, but numMixer borrows the "size" integers at "data"
+		// without copying them.
+		//
+		// PRECONDITIONS:
+		// * The values must outlive the object and must not change while it
+		// exists.
+
+		numMixerTmVolatileSeer(int q, numDatasetHandle dataset);
+		// * Same as above, but numMixer shares the immutable "dataset" with
+		// any other holders instead of building its own.
+
 		// Functionality
 
 		bool ping(std::vector<int>& returnValues) override;
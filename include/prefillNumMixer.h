@@ -0,0 +1,313 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: prefillNumMixer.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * Every value buffered for a controller class was drawn for that class from
+// the current dataset; buffered values are never handed out twice.
+
+// DESCRIPTION:
+// * A numMixer whose values are drawn ahead of time. A background producer
+// keeps one ring buffer per controller class (MIX, EVEN, ODD) topped up, so a
+// ping is one or two memcpy calls out of the ring of the current controller
+// state, with latency independent of the dataset and of bursts of pings.
+// * A ping that finds too few buffered values (an underrun) draws them
+// directly instead, as numMixer::ping() would, and is counted, so callers can
+// size the buffers from the underrun counters.
+
+// ASSUMPTIONS:
+// * The dataset, countdown (10-20), state change count and MIX/EVEN/ODD
+// controller states behave as in numMixer. Other controller states are never
+// valid.
+// * Each class has its own ring, filled from its own stream, so changing the
+// controller state just switches rings: no buffered value is discarded, and a
+// value of one class is never returned for another.
+// * Rings are single producer, single consumer: the producer publishes values
+// by advancing the ring's head, the pinging thread consumes them by
+// advancing its tail, and neither ever locks while the producer is awake.
+// The producer refills a ring once it is half empty, and sleeps while none
+// is. It announces its sleep before checking the rings, and a ping that
+// leaves a ring half empty (or underruns) checks the announcement after
+// advancing the tail, so one of the two always sees the other: no wakeup is
+// lost. Only a ping that finds the producer asleep takes the lock, to notify
+// it.
+// * Rings hold a power of two values each, the buffer size rounded up. A ping
+// larger than a ring is always drawn directly.
+// * seed() stops the producer, discards every buffered value and restarts it,
+// so the values after it are reproducible as long as no ping underruns.
+// * One thread pings at a time.
+// * prefillNumMixer is an alias for basicPrefillNumMixer<int, std::mt19937>.
+// Supported element types and engines are explicitly instantiated in
+// prefillNumMixer.cpp.
+
+
+#ifndef prefillNumMixer_INCLUDED
+#define prefillNumMixer_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <atomic>  // atomic
+#include <condition_variable>  // condition_variable
+#include <memory>  // unique_ptr
+#include <mutex>  // mutex
+#include <random>  // mt19937
+#include <thread>  // thread
+#include <vector>  // vector
+
+
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+
+
+template <class T = int, class Engine = std::mt19937>
+class basicPrefillNumMixer : public numMixerTypes
+{
+	public:
+		// Constructors
+
+		basicPrefillNumMixer(std::size_t bufferSize = 4096);
+		// DESCRIPTION:
+		// * Samples the values 1-100, like the default numMixer, buffering
+		// up to "bufferSize" values per controller class.
+		// * Starts the producer.
+		//
+		// POSTCONDITIONS:
+		// * The controller state is set to "Mix".
+		// * The countdown is randomly set to 10-20.
+
+		basicPrefillNumMixer(basicNumDatasetHandle<T> dataset,
+		                     std::size_t bufferSize = 4096);
+		// DESCRIPTION:
+		// * Samples the shared "dataset". A null handle is treated as an
+		// empty dataset.
+		// * Otherwise behaves like the default constructor.
+
+		basicPrefillNumMixer(const basicPrefillNumMixer&) = delete;
+		basicPrefillNumMixer& operator=(const basicPrefillNumMixer&) = delete;
+
+		~basicPrefillNumMixer();
+		// DESCRIPTION:
+		// * Stops the producer.
+
+
+		// Functionality
+
+		bool ping(std::vector<T>& returnValues);
+		bool ping(T* values, std::size_t count);
+		// DESCRIPTION:
+		// * Stores a random selection of values from the dataset into
+		// "returnValues", or the "count" values at "values", as
+		// numMixer::ping() does: copied from the buffer of the controller
+		// state's class, or drawn directly if it holds too few.
+		// * Returns false if the mixer is inactive or the requested parity
+		// does not exist.
+		//
+		// POSTCONDITIONS:
+		// * If the call succeeds, the countdown is decremented.
+
+
+		// Accessors
+
+		bool isActive() const;
+		// DESCRIPTION:
+		// * Returns whether the mixer is still active.
+
+		int stateChangeCount() const;
+		// DESCRIPTION:
+		// * Returns how many times the output controller has changed state.
+
+		OutputController getControllerState() const;
+		// DESCRIPTION:
+		// * Returns the state of the OutputController.
+
+		std::size_t datasetSize() const;
+		// DESCRIPTION:
+		// * Returns the number of values in the dataset.
+
+		basicNumDatasetHandle<T> dataset() const;
+		// DESCRIPTION:
+		// * Returns a shared handle to the dataset.
+
+		std::size_t bufferSize() const;
+		// DESCRIPTION:
+		// * Returns the number of values each ring holds.
+
+		std::size_t buffered(OutputController state) const;
+		// DESCRIPTION:
+		// * Returns the number of values buffered for "state", which is 0
+		// for states other than MIX, EVEN and ODD.
+
+		std::uint64_t underrunCount() const;
+		std::uint64_t underrunCount(OutputController state) const;
+		// DESCRIPTION:
+		// * Returns the number of successful pings that were drawn directly
+		// because the buffer held too few values, in total or for "state".
+
+
+		// Mutators
+
+		void seed(std::uint64_t value);
+		// DESCRIPTION:
+		// * Discards the buffered values and reseeds every stream, making
+		// the values of the following pings reproducible unless they
+		// underrun.
+
+		void setControllerState(OutputController state);
+		// DESCRIPTION:
+		// * Changes the output controller to "state" if it is not already set.
+		//
+		// POSTCONDITIONS:
+		// * The state change count is incremented if the state changed.
+
+
+	private:
+		// Types
+
+		struct ring
+		{
+			std::unique_ptr<T[]> values;
+			std::atomic<std::size_t> head;
+			std::atomic<std::size_t> tail;
+			std::atomic<std::uint64_t> underruns;
+			basicNumMixer<T, Engine> sampler;
+		};
+		// The buffer of one controller class. "head" counts the values ever
+		// produced and "tail" those consumed, so head - tail are buffered,
+		// at positions masked by the ring size. "sampler" draws the values
+		// with the ring's own stream; the producer owns it.
+
+
+		// Members
+
+		basicNumDatasetHandle<T> _dataset;
+		// The values to be randomly returned in pings.
+
+		std::size_t _mask;
+		// The ring size minus one.
+
+		std::unique_ptr<ring[]> _rings;
+		// One ring per class, indexed by OutputController.
+
+		basicNumMixer<T, Engine> _direct;
+		// Draws the values of pings that underrun, on the pinging thread.
+
+		std::thread _producer;
+		// Keeps the rings topped up.
+
+		std::atomic<bool> _stopping;
+		// Asks the producer to stop.
+
+		std::atomic<bool> _sleeping;
+		// Whether the producer is asleep or about to check the rings and
+		// sleep. Only set and cleared under _wakeLock.
+
+		std::mutex _wakeLock;
+		std::condition_variable _wake;
+		// The producer sleeps on _wake while no ring needs refilling.
+
+		int _stateChangeCount;
+		// Stores how many times the OutputController has changed state.
+
+		int _countDown;
+		// Stores how many pings are left.
+
+		OutputController _controllerState;
+		// Determines the parity of the values to be returned.
+
+
+		// Utility
+
+		void initialize(std::size_t bufferSize, std::uint64_t key);
+		// DESCRIPTION:
+		// * Creates the rings, seeds every stream from "key", sets the
+		// countdown to a random value of 10-20 and starts the producer.
+		// Shared by every constructor.
+
+		void rekey(std::uint64_t key);
+		// DESCRIPTION:
+		// * Empties the rings and seeds every stream from "key", through a
+		// splitMix64 counter split.
+		//
+		// PRECONDITIONS:
+		// * The producer must not be running.
+
+		void start();
+		void stop();
+		// DESCRIPTION:
+		// * Start the producer, or stop it and wait for it.
+
+		void produce();
+		// DESCRIPTION:
+		// * Body of the producer: refills rings until asked to stop.
+
+		void wakeProducer();
+		// DESCRIPTION:
+		// * Wakes the producer, under _wakeLock, if it is asleep. Called
+		// after consuming from a ring.
+
+		bool refill(ring& buffer);
+		// DESCRIPTION:
+		// * Tops "buffer" up if it is at least half empty and returns whether
+		// it did.
+
+		bool hungry() const;
+		// DESCRIPTION:
+		// * Returns whether any ring of a valid class is at least half empty.
+
+		bool checkStateValid(OutputController state) const;
+		// DESCRIPTION:
+		// * Returns whether a ping for "state" can be evaluated.
+};
+
+
+template <class T, class Engine>
+inline bool basicPrefillNumMixer<T, Engine>::isActive() const
+{
+	return (_countDown > 0);
+}
+
+
+template <class T, class Engine>
+inline int basicPrefillNumMixer<T, Engine>::stateChangeCount() const
+{
+	return _stateChangeCount;
+}
+
+
+template <class T, class Engine>
+inline numMixerTypes::OutputController
+basicPrefillNumMixer<T, Engine>::getControllerState() const
+{
+	return _controllerState;
+}
+
+
+template <class T, class Engine>
+inline std::size_t basicPrefillNumMixer<T, Engine>::datasetSize() const
+{
+	return _dataset->size();
+}
+
+
+template <class T, class Engine>
+inline basicNumDatasetHandle<T>
+basicPrefillNumMixer<T, Engine>::dataset() const
+{
+	return _dataset;
+}
+
+
+template <class T, class Engine>
+inline std::size_t basicPrefillNumMixer<T, Engine>::bufferSize() const
+{
+	return _mask + 1;
+}
+
+
+typedef basicPrefillNumMixer<> prefillNumMixer;
+
+
+#endif
\ No newline at end of file
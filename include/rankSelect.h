@@ -0,0 +1,230 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: rankSelect.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * Rank and select queries are only valid after build() has been called on
+// the current bits.
+
+// DESCRIPTION:
+// * A compact bitmap with rank/select support, used to index classes of
+// dataset positions (e.g. the odd values of a dataset that cannot be
+// reordered) without storing a position per member.
+// * Costs about 1.1 bits per position.
+
+// ASSUMPTIONS:
+// * Bits are set one at a time with set() and then build() computes the rank
+// directory.
+// * The rank directory stores the number of set bits preceding every block of
+// 512 bits.
+// * Select hints record the block holding every 8192nd set (and unset) bit,
+// so select only binary searches the few blocks between two hints before
+// scanning at most 8 words.
+// * select1(j) returns the position of the j-th set bit (0-based), select0(j)
+// the position of the j-th unset bit.
+
+
+#ifndef rankSelect_INCLUDED
+#define rankSelect_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <vector>  // vector
+
+
+class rankSelect
+{
+	public:
+		// Constructors
+
+		rankSelect();
+		// DESCRIPTION:
+		// * Creates an empty bitmap.
+
+		rankSelect(std::size_t size);
+		// DESCRIPTION:
+		// * Creates a bitmap of "size" unset bits.
+
+
+		// Functionality
+
+		void set(std::size_t pos);
+		// DESCRIPTION:
+		// * Sets the bit at "pos".
+		//
+		// PRECONDITIONS:
+		// * "pos" must be less than size().
+		//
+		// POSTCONDITIONS:
+		// * build() must be called again before rank/select queries.
+
+		void reset(std::size_t pos);
+		// DESCRIPTION:
+		// * Clears the bit at "pos".
+		//
+		// PRECONDITIONS:
+		// * "pos" must be less than size().
+		//
+		// POSTCONDITIONS:
+		// * build() must be called again before rank/select queries.
+
+		void setWord(std::size_t w, std::uint64_t bits);
+		// DESCRIPTION:
+		// * Sets the bits from 64 * "w" to 64 * "w" + 63 to "bits", low bit
+		// first. Distinct words can be set from different threads at once.
+		//
+		// PRECONDITIONS:
+		// * Bits of "bits" at or past size() must be unset.
+		//
+		// POSTCONDITIONS:
+		// * build() must be called again before rank/select queries.
+
+		void resize(std::size_t size);
+		// DESCRIPTION:
+		// * Changes the number of bits to "size". Added bits are unset.
+		//
+		// POSTCONDITIONS:
+		// * build() must be called again before rank/select queries.
+
+		void build();
+		// DESCRIPTION:
+		// * Computes the rank directory and select hints for the current bits.
+
+		std::size_t rank1(std::size_t pos) const;
+		// DESCRIPTION:
+		// * Returns the number of set bits before "pos".
+
+		std::size_t select1(std::size_t j) const;
+		// DESCRIPTION:
+		// * Returns the position of the "j"-th set bit.
+		//
+		// PRECONDITIONS:
+		// * "j" must be less than ones().
+
+		std::size_t select0(std::size_t j) const;
+		// DESCRIPTION:
+		// * Returns the position of the "j"-th unset bit.
+		//
+		// PRECONDITIONS:
+		// * "j" must be less than zeros().
+
+		static unsigned selectInWord(std::uint64_t word, unsigned j);
+		// DESCRIPTION:
+		// * Returns the bit position of the "j"-th set bit of "word".
+		//
+		// PRECONDITIONS:
+		// * "word" must have more than "j" set bits.
+
+
+		// Accessors
+
+		bool test(std::size_t pos) const;
+		// DESCRIPTION:
+		// * Returns whether the bit at "pos" is set.
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the number of bits.
+
+		std::uint64_t word(std::size_t w) const;
+		// DESCRIPTION:
+		// * Returns the bits from 64 * "w" to 64 * "w" + 63, low bit first.
+
+		std::size_t ones() const;
+		// DESCRIPTION:
+		// * Returns the number of set bits, as of the last build().
+
+		std::size_t zeros() const;
+		// DESCRIPTION:
+		// * Returns the number of unset bits, as of the last build().
+
+		std::size_t memoryUsage() const;
+		// DESCRIPTION:
+		// * Returns the number of bytes used by the bitmap and its directory.
+
+
+	private:
+		// Members
+
+		static const std::size_t _BLOCK_WORDS = 8;
+		// Words per rank block (512 bits).
+
+		static const std::size_t _HINT_STEP = 8192;
+		// Set/unset bits between two select hints.
+
+		std::size_t _size;
+		// The number of bits.
+
+		std::vector<std::uint64_t> _words;
+		// The bits, 64 per word.
+
+		std::vector<std::uint64_t> _ranks;
+		// Set bits preceding each block, plus the total at the end.
+
+		std::vector<std::size_t> _hints1;
+		// Block holding every _HINT_STEP-th set bit.
+
+		std::vector<std::size_t> _hints0;
+		// Block holding every _HINT_STEP-th unset bit.
+
+
+		// Utility
+
+		std::size_t blockZeros(std::size_t block) const;
+		// DESCRIPTION:
+		// * Returns the number of unset bits preceding "block".
+};
+
+
+inline void rankSelect::set(std::size_t pos)
+{
+	_words[pos >> 6] |= (1ULL << (pos & 63));
+}
+
+
+inline void rankSelect::setWord(std::size_t w, std::uint64_t bits)
+{
+	_words[w] = bits;
+}
+
+
+inline void rankSelect::reset(std::size_t pos)
+{
+	_words[pos >> 6] &= ~(1ULL << (pos & 63));
+}
+
+
+inline bool rankSelect::test(std::size_t pos) const
+{
+	return (_words[pos >> 6] >> (pos & 63)) & 1;
+}
+
+
+inline std::size_t rankSelect::size() const
+{
+	return _size;
+}
+
+
+inline std::uint64_t rankSelect::word(std::size_t w) const
+{
+	return _words[w];
+}
+
+
+inline std::size_t rankSelect::ones() const
+{
+	return _ranks.empty() ? 0 : _ranks.back();
+}
+
+
+inline std::size_t rankSelect::zeros() const
+{
+	return _size - ones();
+}
+
+
+#endif
\ No newline at end of file
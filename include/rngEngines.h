@@ -0,0 +1,545 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: rngEngines.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Small, fast random number engines that can be plugged into numMixer,
+// tmSeer and volatileSeer in place of std::mt19937.
+// * splitMix64: 8 bytes of state, mostly used to seed the other engines.
+// * xoshiro256ss: xoshiro256**, 32 bytes of state, supports jump-ahead.
+// * pcg64: PCG XSL-RR 128/64, 32 bytes of state (state + stream).
+// * wordEngine: adapts any engine to a stream of 32-bit words, splitting
+// 64-bit outputs in two so no random bits are wasted.
+
+// ASSUMPTIONS:
+// * Every engine satisfies the standard's uniform random bit generator
+// requirements, so it can be used with the <random> distributions.
+// * Every engine can be seeded with a single 64-bit value.
+// * 128-bit arithmetic is done with 64-bit halves so no compiler extension
+// is required.
+
+
+#ifndef rngEngines_INCLUDED
+#define rngEngines_INCLUDED
+
+
+#include <cstdint>  // uint32_t, uint64_t
+
+
+class splitMix64
+{
+	public:
+		// Types
+
+		typedef std::uint64_t result_type;
+
+
+		// Constructors
+
+		explicit splitMix64(result_type value = 0);
+		// DESCRIPTION:
+		// * Seeds the engine with "value".
+
+
+		// Functionality
+
+		result_type operator()();
+		// DESCRIPTION:
+		// * Advances the engine and returns the next 64-bit output.
+
+		void discard(unsigned long long count);
+		// DESCRIPTION:
+		// * Advances the engine "count" times.
+
+
+		// Accessors
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return ~result_type(0); }
+
+
+		// Mutators
+
+		void seed(result_type value = 0);
+		// DESCRIPTION:
+		// * Reseeds the engine with "value".
+
+
+	private:
+		// Members
+
+		std::uint64_t _state;
+		// The Weyl sequence counter.
+};
+
+
+class xoshiro256ss
+{
+	public:
+		// Types
+
+		typedef std::uint64_t result_type;
+
+
+		// Constructors
+
+		explicit xoshiro256ss(result_type value = 0);
+		// DESCRIPTION:
+		// * Seeds the engine with "value", expanded through splitMix64.
+
+
+		// Functionality
+
+		result_type operator()();
+		// DESCRIPTION:
+		// * Advances the engine and returns the next 64-bit output.
+
+		void discard(unsigned long long count);
+		// DESCRIPTION:
+		// * Advances the engine "count" times.
+
+		void jump();
+		// DESCRIPTION:
+		// * Advances the engine by 2^128 outputs, producing a stream that does
+		// not overlap the current one for any practical request size.
+
+		void longJump();
+		// DESCRIPTION:
+		// * Advances the engine by 2^192 outputs.
+
+
+		// Accessors
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return ~result_type(0); }
+
+
+		// Mutators
+
+		void seed(result_type value = 0);
+		// DESCRIPTION:
+		// * Reseeds the engine with "value", expanded through splitMix64.
+
+
+	private:
+		// Members
+
+		std::uint64_t _state[4];
+		// The generator's 256-bit state.
+
+
+		// Utility
+
+		void applyJump(const std::uint64_t* polynomial);
+		// DESCRIPTION:
+		// * Advances the state by the jump described by "polynomial".
+};
+
+
+class pcg64
+{
+	public:
+		// Types
+
+		typedef std::uint64_t result_type;
+
+
+		// Constructors
+
+		explicit pcg64(result_type value = 0);
+		// DESCRIPTION:
+		// * Seeds the engine with "value" on the default stream.
+
+
+		// Functionality
+
+		result_type operator()();
+		// DESCRIPTION:
+		// * Advances the engine and returns the next 64-bit output.
+
+		void discard(unsigned long long count);
+		// DESCRIPTION:
+		// * Advances the engine "count" times.
+
+
+		// Accessors
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return ~result_type(0); }
+
+
+		// Mutators
+
+		void seed(result_type value = 0);
+		// DESCRIPTION:
+		// * Reseeds the engine with "value" on the default stream.
+
+
+	private:
+		// Members
+
+		std::uint64_t _stateHigh;
+		std::uint64_t _stateLow;
+		// The 128-bit LCG state.
+
+		static const std::uint64_t _MULT_HIGH = 0x2360ED051FC65DA4ULL;
+		static const std::uint64_t _MULT_LOW = 0x4385DF649FCCF645ULL;
+		// The 128-bit LCG multiplier.
+
+		static const std::uint64_t _INC_HIGH = 0x5851F42D4C957F2DULL;
+		static const std::uint64_t _INC_LOW = 0x14057B7EF767814FULL;
+		// The 128-bit LCG increment (default stream).
+
+
+		// Utility
+
+		void step();
+		// DESCRIPTION:
+		// * Advances the 128-bit LCG state once.
+};
+
+
+template <class Engine, bool WIDE = (Engine::max() > 0xFFFFFFFFULL)>
+class wordEngine
+{
+	public:
+		// Types
+
+		typedef std::uint32_t result_type;
+
+
+		// Constructors
+
+		explicit wordEngine(std::uint64_t value = 0);
+		// DESCRIPTION:
+		// * Seeds the underlying engine with "value".
+
+
+		// Functionality
+
+		result_type operator()();
+		// DESCRIPTION:
+		// * Returns the next 32-bit word. 64-bit outputs are split into two
+		// words, low half first.
+
+
+		// Accessors
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return ~result_type(0); }
+
+		Engine& engine();
+		// DESCRIPTION:
+		// * Returns the underlying engine.
+
+
+		// Mutators
+
+		void seed(std::uint64_t value);
+		// DESCRIPTION:
+		// * Reseeds the underlying engine and drops any buffered half word.
+
+
+	private:
+		// Members
+
+		Engine _eng;
+		// The underlying engine.
+
+		std::uint32_t _spare;
+		// The high half of the last 64-bit output, while it is unused.
+
+		bool _hasSpare;
+		// Whether _spare still holds an unused word.
+};
+
+
+template <class Engine>
+class wordEngine<Engine, false>
+{
+	public:
+		// Types
+
+		typedef std::uint32_t result_type;
+
+
+		// Constructors
+
+		explicit wordEngine(std::uint64_t value = 0);
+		// DESCRIPTION:
+		// * Seeds the underlying engine with "value".
+
+
+		// Functionality
+
+		result_type operator()();
+		// DESCRIPTION:
+		// * Returns the next output of the underlying engine unchanged.
+
+
+		// Accessors
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return ~result_type(0); }
+
+		Engine& engine();
+		// DESCRIPTION:
+		// * Returns the underlying engine.
+
+
+		// Mutators
+
+		void seed(std::uint64_t value);
+		// DESCRIPTION:
+		// * Reseeds the underlying engine.
+
+
+	private:
+		// Members
+
+		Engine _eng;
+		// The underlying engine.
+};
+
+
+inline std::uint64_t rotateLeft(std::uint64_t x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+
+inline splitMix64::splitMix64(result_type value):
+	_state(value)
+{
+}
+
+
+inline splitMix64::result_type splitMix64::operator()()
+{
+	std::uint64_t z = (_state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+
+inline void splitMix64::discard(unsigned long long count)
+{
+	_state += count * 0x9E3779B97F4A7C15ULL;
+}
+
+
+inline void splitMix64::seed(result_type value)
+{
+	_state = value;
+}
+
+
+inline xoshiro256ss::xoshiro256ss(result_type value)
+{
+	seed(value);
+}
+
+
+inline xoshiro256ss::result_type xoshiro256ss::operator()()
+{
+	const std::uint64_t result = rotateLeft(_state[1] * 5, 7) * 9;
+	const std::uint64_t t = _state[1] << 17;
+	_state[2] ^= _state[0];
+	_state[3] ^= _state[1];
+	_state[1] ^= _state[2];
+	_state[0] ^= _state[3];
+	_state[2] ^= t;
+	_state[3] = rotateLeft(_state[3], 45);
+	return result;
+}
+
+
+inline void xoshiro256ss::discard(unsigned long long count)
+{
+	while (count--) {
+		(*this)();
+	}
+}
+
+
+inline void xoshiro256ss::jump()
+{
+	static const std::uint64_t JUMP[] = {
+		0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+		0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+	};
+	applyJump(JUMP);
+}
+
+
+inline void xoshiro256ss::longJump()
+{
+	static const std::uint64_t LONG_JUMP[] = {
+		0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+		0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+	};
+	applyJump(LONG_JUMP);
+}
+
+
+inline void xoshiro256ss::seed(result_type value)
+{
+	splitMix64 seeder(value);
+	for (auto& word : _state) {
+		word = seeder();
+	}
+}
+
+
+inline void xoshiro256ss::applyJump(const std::uint64_t* polynomial)
+{
+	std::uint64_t jumped[4] = { 0, 0, 0, 0 };
+	for (int i = 0; i < 4; ++i) {
+		for (int bit = 0; bit < 64; ++bit) {
+			if (polynomial[i] & (1ULL << bit)) {
+				for (int j = 0; j < 4; ++j) {
+					jumped[j] ^= _state[j];
+				}
+			}
+			(*this)();
+		}
+	}
+	for (int j = 0; j < 4; ++j) {
+		_state[j] = jumped[j];
+	}
+}
+
+
+inline pcg64::pcg64(result_type value)
+{
+	seed(value);
+}
+
+
+inline pcg64::result_type pcg64::operator()()
+{
+	step();
+	const std::uint64_t x = _stateHigh ^ _stateLow;
+	const unsigned rot = static_cast<unsigned>(_stateHigh >> 58);
+	return (x >> rot) | (x << ((64 - rot) & 63));
+}
+
+
+inline void pcg64::discard(unsigned long long count)
+{
+	while (count--) {
+		step();
+	}
+}
+
+
+inline void pcg64::seed(result_type value)
+{
+	_stateHigh = 0;
+	_stateLow = 0;
+	step();
+	const std::uint64_t low = _stateLow + value;
+	_stateHigh += (low < _stateLow);
+	_stateLow = low;
+	step();
+}
+
+
+inline void pcg64::step()
+{
+	// 64x64 -> 128 multiply of the low halves, using 32-bit limbs
+	const std::uint64_t aLo = _stateLow & 0xFFFFFFFFULL;
+	const std::uint64_t aHi = _stateLow >> 32;
+	const std::uint64_t bLo = _MULT_LOW & 0xFFFFFFFFULL;
+	const std::uint64_t bHi = _MULT_LOW >> 32;
+	const std::uint64_t loLo = aLo * bLo;
+	const std::uint64_t hiLo = aHi * bLo;
+	const std::uint64_t loHi = aLo * bHi;
+	const std::uint64_t hiHi = aHi * bHi;
+	const std::uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFULL) + loHi;
+	std::uint64_t high = hiHi + (hiLo >> 32) + (cross >> 32);
+	std::uint64_t low = (cross << 32) | (loLo & 0xFFFFFFFFULL);
+
+	// cross terms only affect the high half modulo 2^128
+	high += _stateHigh * _MULT_LOW + _stateLow * _MULT_HIGH;
+
+	// add the increment
+	const std::uint64_t sumLow = low + _INC_LOW;
+	high += _INC_HIGH + (sumLow < low);
+	_stateHigh = high;
+	_stateLow = sumLow;
+}
+
+
+template <class Engine, bool WIDE>
+wordEngine<Engine, WIDE>::wordEngine(std::uint64_t value):
+	_eng(value),
+	_spare(0),
+	_hasSpare(false)
+{
+}
+
+
+template <class Engine, bool WIDE>
+inline typename wordEngine<Engine, WIDE>::result_type
+wordEngine<Engine, WIDE>::operator()()
+{
+	if (_hasSpare) {
+		_hasSpare = false;
+		return _spare;
+	}
+	const std::uint64_t word = _eng();
+	_spare = static_cast<std::uint32_t>(word >> 32);
+	_hasSpare = true;
+	return static_cast<std::uint32_t>(word);
+}
+
+
+template <class Engine, bool WIDE>
+inline Engine& wordEngine<Engine, WIDE>::engine()
+{
+	return _eng;
+}
+
+
+template <class Engine, bool WIDE>
+inline void wordEngine<Engine, WIDE>::seed(std::uint64_t value)
+{
+	_eng.seed(value);
+	_hasSpare = false;
+}
+
+
+template <class Engine>
+wordEngine<Engine, false>::wordEngine(std::uint64_t value):
+	_eng(value)
+{
+}
+
+
+template <class Engine>
+inline typename wordEngine<Engine, false>::result_type
+wordEngine<Engine, false>::operator()()
+{
+	return static_cast<std::uint32_t>(_eng());
+}
+
+
+template <class Engine>
+inline Engine& wordEngine<Engine, false>::engine()
+{
+	return _eng;
+}
+
+
+template <class Engine>
+inline void wordEngine<Engine, false>::seed(std::uint64_t value)
+{
+	_eng.seed(value);
+}
+
+
+#endif
\ No newline at end of file
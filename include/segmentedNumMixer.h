@@ -0,0 +1,260 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: segmentedNumMixer.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * The size prefix sums always describe the current segments: entry s holds
+// the number of values in the segments before s. The even and odd prefix sums
+// do too once built, and are empty until then.
+
+// DESCRIPTION:
+// * A numMixer over the union of several datasets (segments), without
+// concatenating them. Each segment is a shared dataset handle, so owned
+// vectors, borrowed memory, memory mapped files and datasets shared with other
+// mixers can be mixed freely and are never copied.
+// * A uniform draw over the union is a single bounded random index into the
+// union, located in its segment by binary searching the prefix sums of the
+// segment sizes: O(log segments) per value.
+// * Segments can be added and removed at runtime.
+
+// ASSUMPTIONS:
+// * The countdown (10-20), state change count and MIX/EVEN/ODD controller
+// states behave as in numMixer. Even/odd validity is combined across the
+// segments: a parity is valid if any segment holds a value of it. Other
+// controller states are never valid.
+// * Segment prefix sums are kept for all values, evens and odds, so each
+// controller state draws from its own union without rejection. Adding or
+// removing a segment recomputes the size prefix sums in O(segments). The
+// even and odd ones are rebuilt on the next EVEN or ODD ping, since counting
+// parities runs the deferred parity pass of borrowed and mapped segments: a
+// mixer that only ever mixes never scans its segments.
+// * Segments are identified by their position, in insertion order. Removing
+// a segment shifts the positions of the segments after it.
+// * A value present in several segments is drawn with the combined weight of
+// its copies, as if the segments had been concatenated.
+// * segmentedNumMixer is an alias for basicSegmentedNumMixer<int,
+// std::mt19937>. Supported element types and engines are explicitly
+// instantiated in segmentedNumMixer.cpp.
+
+
+#ifndef segmentedNumMixer_INCLUDED
+#define segmentedNumMixer_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <random>  // mt19937
+#include <string>  // string
+#include <vector>  // vector
+
+
+#include "../include/mappedFile.h"
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+
+
+template <class T = int, class Engine = std::mt19937>
+class basicSegmentedNumMixer : public numMixerTypes
+{
+	public:
+		// Constructors
+
+		basicSegmentedNumMixer();
+		// DESCRIPTION:
+		// * Creates a mixer with no segments.
+		//
+		// POSTCONDITIONS:
+		// * The controller state is set to "Mix".
+		// * The countdown is randomly set to 10-20.
+		// * Pings fail until a non-empty segment is added.
+
+		basicSegmentedNumMixer(
+			const std::vector<basicNumDatasetHandle<T> >& segments);
+		// DESCRIPTION:
+		// * Creates a mixer over "segments", in order. Null handles are
+		// skipped.
+		// * Otherwise behaves like the default constructor.
+
+
+		// Functionality
+
+		bool ping(std::vector<T>& returnValues);
+		// DESCRIPTION:
+		// * Stores a random selection of values from the union of the
+		// segments into "returnValues", as numMixer::ping() does.
+		// * Returns false if the numMixer is inactive, or the requested
+		// parity does not exist in any segment.
+		//
+		// POSTCONDITIONS:
+		// * If the call succeeds, the countdown is decremented.
+
+
+		// Accessors
+
+		bool isActive() const;
+		// DESCRIPTION:
+		// * Returns whether the mixer is still active.
+
+		int stateChangeCount() const;
+		// DESCRIPTION:
+		// * Returns how many times the output controller has changed state.
+
+		OutputController getControllerState() const;
+		// DESCRIPTION:
+		// * Returns the state of the OutputController.
+
+		std::size_t datasetSize() const;
+		// DESCRIPTION:
+		// * Returns the number of values in the union of the segments.
+
+		std::size_t segmentCount() const;
+		// DESCRIPTION:
+		// * Returns the number of segments.
+
+		basicNumDatasetHandle<T> segment(std::size_t i) const;
+		// DESCRIPTION:
+		// * Returns a shared handle to the "i"-th segment.
+		//
+		// PRECONDITIONS:
+		// * "i" must be less than segmentCount().
+
+
+		// Mutators
+
+		void seed(std::uint64_t value);
+		// DESCRIPTION:
+		// * Reseeds the random number engine, making the values of the
+		// following pings reproducible.
+
+		void setControllerState(OutputController state);
+		// DESCRIPTION:
+		// * Changes the output controller to "state" if it is not already set.
+		//
+		// POSTCONDITIONS:
+		// * The state change count is incremented if the state changed.
+
+		bool addSegment(basicNumDatasetHandle<T> segment);
+		bool addSegment(std::vector<T>&& values);
+		bool addSegment(const std::string& path,
+		                int mapFlags = mappedFile::DEFAULT);
+		// DESCRIPTION:
+		// * Appends a segment: a shared dataset, values moved into a new
+		// dataset (no copy), or a memory mapped flat binary file.
+		// * Returns false, adding nothing, if "segment" is null or the file
+		// could not be mapped.
+
+		bool removeSegment(std::size_t i);
+		// DESCRIPTION:
+		// * Removes the "i"-th segment. The dataset is released once no
+		// other holder shares it.
+		// * Returns false if "i" is out of range.
+
+
+	private:
+		// Members
+
+		std::vector<basicNumDatasetHandle<T> > _segments;
+		// The segments, in insertion order.
+
+		std::vector<std::size_t> _sizePrefix;
+		std::vector<std::size_t> _evenPrefix;
+		std::vector<std::size_t> _oddPrefix;
+		// Values, even values and odd values in the segments before each
+		// segment, plus the totals at the end. The even and odd ones are
+		// empty until indexParity() builds them.
+
+		int _stateChangeCount;
+		// Stores how many times the OutputController has changed state.
+
+		int _countDown;
+		// Stores how many pings are left.
+
+		wordEngine<Engine> _eng;
+		// The random number engine values are drawn with.
+
+		OutputController _controllerState;
+		// Determines the parity of the values to be returned.
+
+
+		// Utility
+
+		void indexSegments();
+		// DESCRIPTION:
+		// * Recomputes the size prefix sums of the segments and drops the
+		// even and odd ones.
+
+		void indexParity();
+		// DESCRIPTION:
+		// * Builds the even and odd prefix sums of the segments, if they
+		// are not built yet.
+
+		const std::vector<std::size_t>& controllerPrefix() const;
+		// DESCRIPTION:
+		// * Returns the prefix sums of the controller state's values, which
+		// must be MIX, EVEN or ODD.
+
+		bool checkStateValid();
+		// DESCRIPTION:
+		// * Returns whether a ping for the current controller state can be
+		// evaluated, building the even and odd prefix sums for EVEN and ODD.
+
+		T drawValue(const std::vector<std::size_t>& prefix);
+		// DESCRIPTION:
+		// * Draws one value uniformly from the union counted by "prefix".
+		//
+		// PRECONDITIONS:
+		// * The union must not be empty.
+};
+
+
+template <class T, class Engine>
+inline bool basicSegmentedNumMixer<T, Engine>::isActive() const
+{
+	return (_countDown > 0);
+}
+
+
+template <class T, class Engine>
+inline int basicSegmentedNumMixer<T, Engine>::stateChangeCount() const
+{
+	return _stateChangeCount;
+}
+
+
+template <class T, class Engine>
+inline numMixerTypes::OutputController
+basicSegmentedNumMixer<T, Engine>::getControllerState() const
+{
+	return _controllerState;
+}
+
+
+template <class T, class Engine>
+inline std::size_t basicSegmentedNumMixer<T, Engine>::datasetSize() const
+{
+	return _sizePrefix.back();
+}
+
+
+template <class T, class Engine>
+inline std::size_t basicSegmentedNumMixer<T, Engine>::segmentCount() const
+{
+	return _segments.size();
+}
+
+
+template <class T, class Engine>
+inline basicNumDatasetHandle<T>
+basicSegmentedNumMixer<T, Engine>::segment(std::size_t i) const
+{
+	return _segments[i];
+}
+
+
+typedef basicSegmentedNumMixer<> segmentedNumMixer;
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,182 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: sortedIndex.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * The values are in ascending order: within every block, and from the last
+// value of a block to the first of the next.
+// * No block is empty, and none holds 2 * _BLOCK_SIZE values or more.
+
+// DESCRIPTION:
+// * The values of a dataset in ascending order, so the values within a range
+// [low, high] form one slice of positions, found by two binary searches, and
+// the RANGE controller can draw from it with no rejection.
+// * Each dataset builds its index at most once (see numDataset), and every
+// numMixer sharing the dataset draws from it, keeping only the bounds of its
+// own range.
+
+// ASSUMPTIONS:
+// * The values are stored in sorted blocks of 1024 to 2047 values (a blocked
+// order-statistics structure), with a Fenwick tree over the block sizes. An
+// insert or erase binary searches the blocks, shifts at most one block's
+// values and updates the tree: O(_BLOCK_SIZE + log n), instead of shifting
+// half the index on average. A block that fills up is split in two, and an
+// emptied block is dropped, each rebuilding the tree, in O(n / _BLOCK_SIZE)
+// once per _BLOCK_SIZE mutations or so.
+// * Until the first mutation every block but the last holds exactly
+// _BLOCK_SIZE values, so the block of a position is a shift away and at() is
+// O(1). Afterwards at() and the binary searches descend the tree, in
+// O(log n).
+// * Pings gather straight from a block when a range falls within it (see
+// run()), and call at() per value otherwise.
+// * sortedIndex is an alias for basicSortedIndex<int>. Supported element
+// types are explicitly instantiated in sortedIndex.cpp.
+
+
+#ifndef sortedIndex_INCLUDED
+#define sortedIndex_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <vector>  // vector
+
+
+template <class T>
+class basicSortedIndex
+{
+	public:
+		// Constructors
+
+		basicSortedIndex();
+		// DESCRIPTION:
+		// * Creates an empty index.
+
+		explicit basicSortedIndex(const std::vector<T>& sorted);
+		// DESCRIPTION:
+		// * Copies the "sorted" values into blocks.
+		//
+		// PRECONDITIONS:
+		// * "sorted" must be in ascending order.
+
+
+		// Functionality
+
+		void insert(T value);
+		// DESCRIPTION:
+		// * Adds "value" after any equal values, in O(_BLOCK_SIZE + log n)
+		// amortized.
+
+		void erase(T value);
+		// DESCRIPTION:
+		// * Removes one value equal to "value", in O(_BLOCK_SIZE + log n)
+		// amortized.
+		//
+		// PRECONDITIONS:
+		// * The index must hold "value".
+
+		std::size_t lowerBound(T value) const;
+		std::size_t upperBound(T value) const;
+		// DESCRIPTION:
+		// * Returns the position of the first value not less than/greater
+		// than "value", or size() if there is none.
+
+
+		// Accessors
+
+		std::size_t size() const;
+		// DESCRIPTION:
+		// * Returns the number of values.
+
+		T at(std::size_t p) const;
+		// DESCRIPTION:
+		// * Returns the value at position "p": O(1) until the first mutation,
+		// O(log n) after.
+		//
+		// PRECONDITIONS:
+		// * "p" must be less than size().
+
+		const T* run(std::size_t begin, std::size_t end) const;
+		// DESCRIPTION:
+		// * Returns the values at positions ["begin", "end") if they are
+		// stored contiguously (within one block), otherwise null.
+		//
+		// PRECONDITIONS:
+		// * "begin" <= "end" <= size().
+
+		std::size_t memoryUsage() const;
+		// DESCRIPTION:
+		// * Returns the number of bytes used by the values and the tree.
+
+
+	private:
+		// Members
+
+		static const std::size_t _BLOCK_SIZE = 1024;
+		// Values per block when built; blocks split at twice that.
+
+		static const unsigned _BLOCK_BITS = 10;
+		// log2(_BLOCK_SIZE).
+
+		std::vector<std::vector<T> > _blocks;
+		// The values, in ascending order, block after block.
+
+		std::vector<std::size_t> _tree;
+		// The Fenwick tree over the block sizes, 1-based: _tree[i] counts
+		// the values of blocks [i - (i & -i), i).
+
+		std::size_t _size;
+		// The number of values.
+
+		bool _uniform;
+		// Whether every block but the last holds exactly _BLOCK_SIZE values.
+
+
+		// Utility
+
+		std::size_t locate(std::size_t p, std::size_t& offset) const;
+		// DESCRIPTION:
+		// * Returns the block holding position "p" and stores the position
+		// within it into "offset".
+		//
+		// PRECONDITIONS:
+		// * "p" must be less than size().
+
+		std::size_t prefix(std::size_t blocks) const;
+		// DESCRIPTION:
+		// * Returns the number of values in the first "blocks" blocks.
+
+		void buildTree();
+		// DESCRIPTION:
+		// * Recomputes the tree from the block sizes, in O(blocks).
+
+		void resized(std::size_t block, std::ptrdiff_t delta);
+		// DESCRIPTION:
+		// * Records that "block" gained "delta" values.
+};
+
+
+template <class T>
+inline std::size_t basicSortedIndex<T>::size() const
+{
+	return _size;
+}
+
+
+template <class T>
+inline T basicSortedIndex<T>::at(std::size_t p) const
+{
+	if (_uniform) {
+		return _blocks[p >> _BLOCK_BITS][p & (_BLOCK_SIZE - 1)];
+	}
+	std::size_t offset;
+	const std::size_t block = locate(p, offset);
+	return _blocks[block][offset];
+}
+
+
+typedef basicSortedIndex<int> sortedIndex;
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,353 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: streamingNumMixer.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * Each reservoir holds min(capacity(), values of its class seen) values, a
+// uniform sample without replacement of every value of its class seen so far.
+// * Memory use is fixed by the capacity, however long the stream runs.
+
+// DESCRIPTION:
+// * A numMixer over an unbounded stream of integers. Instead of the whole
+// dataset it keeps a bounded reservoir per controller class (MIX, EVEN, ODD),
+// and pings sample from the reservoirs.
+// * The stream is consumed on a background thread, from a std::istream or a
+// file descriptor, so pings never wait for input.
+
+// ASSUMPTIONS:
+// * The stream holds native-endian T values back to back, like the flat
+// files numDataset maps. Trailing bytes that do not form a whole value are
+// ignored.
+// * Reservoirs are maintained with Li's Algorithm L: once a reservoir is
+// full, the number of values to skip before the next replacement is drawn
+// directly, so only O(k log(n / k)) random numbers are drawn for n values.
+// The MIX reservoir skips over whole blocks of input without touching them;
+// the EVEN and ODD reservoirs still classify every value, one parity test
+// each.
+// * The ingesting thread publishes the reservoirs to the pinging thread
+// through a triple buffer: it copies them into a spare buffer and swaps it
+// in with one atomic exchange, and a ping picks up the newest buffer with one
+// more. Neither side ever waits for the other. Reservoirs are published
+// whenever a read returns less than a full block (the source is drained for
+// now), at least once per capacity() values consumed, and at the end of the
+// stream.
+// * The countdown (10-20), state change count and MIX/EVEN/ODD controller
+// states behave as in numMixer. A ping fails while the reservoir of the
+// requested class is still empty. Other controller states are never valid.
+// * One thread pings at a time; ingestion runs on its own thread, and at most
+// one stream is ingested at a time.
+// * stop() and the destructor wait for the read in progress to return, so a
+// source that never delivers data or reports its end blocks them.
+// * A read that fails (a std::istream that throws or goes bad, or a file
+// descriptor read() error) ends the ingestion like the end of the stream:
+// the values consumed so far are published and the failure is kept for
+// error(), never thrown on the ingesting thread.
+// * streamingNumMixer is an alias for basicStreamingNumMixer<int,
+// std::mt19937>. Supported element types and engines are explicitly
+// instantiated in streamingNumMixer.cpp.
+
+
+#ifndef streamingNumMixer_INCLUDED
+#define streamingNumMixer_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <atomic>  // atomic
+#include <exception>  // exception_ptr
+#include <functional>  // function
+#include <istream>  // istream
+#include <random>  // mt19937
+#include <thread>  // thread
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+
+
+template <class T = int, class Engine = std::mt19937>
+class basicStreamingNumMixer : public numMixerTypes
+{
+	public:
+		// Constructors
+
+		explicit basicStreamingNumMixer(std::size_t capacity = 4096);
+		// DESCRIPTION:
+		// * Creates a mixer keeping up to "capacity" values (at least 1) per
+		// controller class.
+		//
+		// POSTCONDITIONS:
+		// * The controller state is set to "Mix".
+		// * The countdown is randomly set to 10-20.
+		// * Pings fail until values have been ingested.
+
+		basicStreamingNumMixer(const basicStreamingNumMixer&) = delete;
+		basicStreamingNumMixer& operator=(const basicStreamingNumMixer&) =
+			delete;
+
+		~basicStreamingNumMixer();
+		// DESCRIPTION:
+		// * Stops ingestion, waiting for the read in progress.
+
+
+		// Functionality
+
+		bool ingest(std::istream& in);
+		bool ingest(int fd);
+		// DESCRIPTION:
+		// * Starts consuming the stream "in", or the file descriptor "fd",
+		// on a background thread until it ends, a read fails (see error())
+		// or stop() is called.
+		// * Returns false, starting nothing, if a stream is already being
+		// ingested.
+		//
+		// PRECONDITIONS:
+		// * "in" must outlive the ingestion; "fd" must stay open until then.
+
+		bool offer(const T* values, std::size_t count);
+		// DESCRIPTION:
+		// * Consumes the "count" values at "values" on the calling thread and
+		// publishes the reservoirs.
+		// * Returns false, consuming nothing, if a stream is being ingested.
+
+		void stop();
+		// DESCRIPTION:
+		// * Stops ingestion after the read in progress and waits for the
+		// background thread. Values consumed so far stay published.
+
+		bool ping(std::vector<T>& returnValues);
+		// DESCRIPTION:
+		// * Stores a random selection of values from the newest published
+		// reservoir of the controller state's class into "returnValues".
+		// * Returns false if the mixer is inactive or that reservoir is
+		// empty.
+		//
+		// POSTCONDITIONS:
+		// * If the call succeeds, the countdown is decremented.
+
+
+		// Accessors
+
+		bool isActive() const;
+		// DESCRIPTION:
+		// * Returns whether the mixer is still active.
+
+		bool ingesting() const;
+		// DESCRIPTION:
+		// * Returns whether a stream is being ingested.
+
+		int stateChangeCount() const;
+		// DESCRIPTION:
+		// * Returns how many times the output controller has changed state.
+
+		OutputController getControllerState() const;
+		// DESCRIPTION:
+		// * Returns the state of the OutputController.
+
+		std::size_t capacity() const;
+		// DESCRIPTION:
+		// * Returns the capacity of each reservoir.
+
+		std::uint64_t seen() const;
+		// DESCRIPTION:
+		// * Returns the number of values consumed so far.
+
+		std::exception_ptr error() const;
+		// DESCRIPTION:
+		// * Returns the exception that ended the last ingestion, or null if
+		// it reached the end of the stream or was stopped, none ran yet, or
+		// one is still running.
+
+
+		// Mutators
+
+		void seed(std::uint64_t value);
+		// DESCRIPTION:
+		// * Reseeds the stream pings draw from, and, unless a stream is being
+		// ingested, the stream the reservoirs are sampled with.
+
+		void setControllerState(OutputController state);
+		// DESCRIPTION:
+		// * Changes the output controller to "state" if it is not already set.
+		//
+		// POSTCONDITIONS:
+		// * The state change count is incremented if the state changed.
+
+
+	private:
+		// Types
+
+		struct reservoirState
+		{
+			std::uint64_t seen;
+			std::uint64_t next;
+			double weight;
+		};
+		// Algorithm L state of one reservoir: the values of its class seen,
+		// the index of the next one to admit once full, and the running
+		// weight W.
+
+		struct snapshot
+		{
+			std::vector<T> reservoirs[3];
+		};
+		// Published copies of the MIX, EVEN and ODD reservoirs.
+
+
+		// Members
+
+		static const unsigned _FRESH = 4;
+		// Marks the middle buffer as newer than the pinging thread's.
+
+		std::size_t _capacity;
+		// The capacity of each reservoir.
+
+		std::vector<T> _reservoirs[3];
+		reservoirState _states[3];
+		// The reservoirs being filled, indexed by OutputController, and their
+		// sampling state. Owned by the ingesting thread.
+
+		wordEngine<Engine> _ingestEng;
+		// Draws the skips and replaced slots. Owned by the ingesting thread.
+
+		snapshot _buffers[3];
+		// The triple buffer.
+
+		unsigned _back;
+		// The buffer the ingesting thread publishes into next.
+
+		std::atomic<unsigned> _middle;
+		// The buffer between the two threads, plus _FRESH if it has not yet
+		// been picked up.
+
+		unsigned _front;
+		// The buffer pings read. Owned by the pinging thread.
+
+		std::atomic<std::uint64_t> _seen;
+		// The number of values consumed.
+
+		std::thread _thread;
+		// The ingesting thread, if any.
+
+		std::atomic<bool> _ingesting;
+		// Whether a stream is being ingested.
+
+		std::atomic<bool> _stopping;
+		// Asks the ingesting thread to stop.
+
+		std::exception_ptr _error;
+		// The failure that ended the last ingestion, if any. Written by the
+		// ingesting thread before it clears _ingesting.
+
+		int _stateChangeCount;
+		// Stores how many times the OutputController has changed state.
+
+		int _countDown;
+		// Stores how many pings are left.
+
+		wordEngine<Engine> _eng;
+		// The random number engine pings draw with.
+
+		OutputController _controllerState;
+		// Determines the class of the values to be returned.
+
+
+		// Utility
+
+		bool start(const std::function<std::size_t(char*, std::size_t)>& read);
+		// DESCRIPTION:
+		// * Starts the ingesting thread over "read", which fills a buffer
+		// with up to the given number of bytes and returns how many it read,
+		// 0 at the end of the stream.
+		// * Returns false if a stream is already being ingested.
+
+		void run(const std::function<std::size_t(char*, std::size_t)>& read);
+		// DESCRIPTION:
+		// * Body of the ingesting thread: reads blocks, consumes their whole
+		// values and publishes the reservoirs. Keeps the exception of a
+		// failing read in _error.
+
+		void consume(const T* values, std::size_t count);
+		// DESCRIPTION:
+		// * Offers the "count" values at "values" to the reservoirs.
+
+		void admit(OutputController state, T value);
+		// DESCRIPTION:
+		// * Offers "value" to the reservoir of "state".
+
+		void startSkipping(reservoirState& state);
+		// DESCRIPTION:
+		// * Draws the first weight and skip of a reservoir that just filled.
+
+		void advance(reservoirState& state);
+		// DESCRIPTION:
+		// * Updates the weight and draws the skip to the next admitted value.
+
+		double uniform();
+		// DESCRIPTION:
+		// * Returns a uniform random number in (0, 1) from _ingestEng.
+
+		void publish();
+		// DESCRIPTION:
+		// * Copies the reservoirs into the back buffer and swaps it into the
+		// middle.
+};
+
+
+template <class T, class Engine>
+inline bool basicStreamingNumMixer<T, Engine>::isActive() const
+{
+	return (_countDown > 0);
+}
+
+
+template <class T, class Engine>
+inline bool basicStreamingNumMixer<T, Engine>::ingesting() const
+{
+	return _ingesting;
+}
+
+
+template <class T, class Engine>
+inline int basicStreamingNumMixer<T, Engine>::stateChangeCount() const
+{
+	return _stateChangeCount;
+}
+
+
+template <class T, class Engine>
+inline numMixerTypes::OutputController
+basicStreamingNumMixer<T, Engine>::getControllerState() const
+{
+	return _controllerState;
+}
+
+
+template <class T, class Engine>
+inline std::size_t basicStreamingNumMixer<T, Engine>::capacity() const
+{
+	return _capacity;
+}
+
+
+template <class T, class Engine>
+inline std::uint64_t basicStreamingNumMixer<T, Engine>::seen() const
+{
+	return _seen;
+}
+
+
+template <class T, class Engine>
+inline std::exception_ptr basicStreamingNumMixer<T, Engine>::error() const
+{
+	return _ingesting ? std::exception_ptr() : _error;
+}
+
+
+typedef basicStreamingNumMixer<> streamingNumMixer;
+
+
+#endif
\ No newline at end of file
@@ -28,25 +28,45 @@
 // * The returned message is mixed arbitrarily via a random number generator.
 // * It iterates through the string and has a 30% chance to mix that character's
 // case.
+// * Case is mixed in blocks: a flip mask is drawn for a block of characters
+// and applied by XORing 0x20 into the alphabetic ASCII characters, 32 (AVX2)
+// or 16 (SSE2) at a time, with a scalar fallback. Defining TMSEER_NO_SIMD
+// forces the scalar kernel. This matches isupper/tolower/toupper in the "C"
+// locale, which the program never changes; other characters are left
+// untouched.
+// * Flips are exact 3/10 Bernoulli decisions drawn from a bitPool, about 2
+// random bits each, so one 64-bit engine word decides some 32 characters.
+// They are drawn 64 at a time as a bit mask (see bitPool::bernoulliMask),
+// which is expanded to a byte per character 32 (AVX2) or 8 at a time.
+// Messages are statistically equivalent to, but not the same as, those of one
+// bounded 0-9 roll per character. The compatibility mode draws the rolls as
+// before, keeping messages bit-exact for a given engine state, and still
+// applies the mask in bulk.
+// * The random number engine is a compile-time template parameter; tmSeer is
+// an alias for basicTmSeer<std::mt19937>. Supported engines are explicitly
+// instantiated in tmSeer.cpp.
 
 
 #ifndef tmSeer_INCLUDED
 #define tmSeer_INCLUDED
 
 
+#include <cstddef>  // size_t
 #include <random>  // mt19937
 #include <string>  // string
 
 
+#include "../include/bitPool.h"
 #include "../include/seer.h"
 
 
-class tmSeer : public virtual seer
+template <class Engine = std::mt19937>
+class basicTmSeer : public virtual seer
 {
 	public:
 		// Constructors
 		
-		tmSeer(int q);
+		basicTmSeer(int q);
 		// DESCRIPTION:
 		// * Initializes _dead, _k, the state change count, the random number
 		// generator, and the name.
@@ -95,6 +115,16 @@ class tmSeer : public virtual seer
 		// * Returns false if the tmSeer is dead or inactive.
 
 
+		// Mutators
+
+		void setCompatibilityMode(bool enabled);
+		// DESCRIPTION:
+		// * When enabled, case mixing draws one bounded 0-9 roll per
+		// character, consuming the random number generator exactly as v2.0.0
+		// did, so the mixed messages are bit-exact.
+		// * Disabled by default.
+
+
 	protected:
 		// Members
 
@@ -115,13 +145,21 @@ class tmSeer : public virtual seer
 		// * Inverts the case of the passed string.
 		// * Interates through the string, and has a 30% chance to flip its
 		// case.
+		// * Flip masks are drawn and applied a block of characters at a time
+		// (see Assumptions).
 
 	private:
 		// Members
 
-		std::mt19937 _eng;
+		Engine _eng;
 		// A random number generator used to mix the message case.
 
+		bitPool _pool;
+		// Spends _eng's words a few bits per flip decision.
+
+		bool _compatible;
+		// Whether case mixing reproduces v2.0.0 bit for bit.
+
 		static const int _Q_MULT = 2;
 		// Multiplier used to determines _k's values
 
@@ -132,7 +170,15 @@ class tmSeer : public virtual seer
 		// DESCRIPTION:
 		// * Generates a random number between and including 0 and the maximum
 		// roll.
+
+		void drawFlips(unsigned char* flips, std::size_t count);
+		// DESCRIPTION:
+		// * Stores 0x20 into each of the "count" bytes at "flips" with a 30%
+		// chance, 0 otherwise.
 };
 
 
+typedef basicTmSeer<> tmSeer;
+
+
 #endif
\ No newline at end of file
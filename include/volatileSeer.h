@@ -22,7 +22,12 @@
 // request().
 // * The volatileSeer randomly rejects requests using a random number generator.
 // * there is a 50% chance to reject a request.
+// * Rejections are exact _REJECT_CHANCE in 10 decisions drawn from a bitPool,
+// a bit or two each, so one engine word settles dozens of requests.
 // * If a request is rejected, the string passed in request() is set to empty.
+// * The random number engine is a compile-time template parameter;
+// volatileSeer is an alias for basicVolatileSeer<std::mt19937>. Supported
+// engines are explicitly instantiated in volatileSeer.cpp.
 
 
 #ifndef volatileSeer_INCLUDED
@@ -33,15 +38,17 @@
 #include <string>  // string
 
 
+#include "../include/bitPool.h"
 #include "../include/seer.h"
 
 
-class volatileSeer : public virtual seer
+template <class Engine = std::mt19937>
+class basicVolatileSeer : public virtual seer
 {
 	public:
 		// Constructors
 		
-		volatileSeer(int q);
+		basicVolatileSeer(int q);
 		// DESCRIPTION:
 		// * Initializes the name and the random number generator.
 		// * "q" is used to determine how many times the volatileSeer can be
@@ -85,13 +92,23 @@ class volatileSeer : public virtual seer
 		// * Generates a random number between and including 0 and the maximum
 		// roll.
 
+		bool rejectRequest();
+		// DESCRIPTION:
+		// * Returns true with a _REJECT_CHANCE in 10 chance.
+
 
 	private:
 		// Members
 
-		std::mt19937 _eng;
+		Engine _eng;
 		// A random number generator used to randomly reject requests.
+
+		bitPool _pool;
+		// Spends _eng's words a few bits per rejection decision.
 };
 
 
+typedef basicVolatileSeer<> volatileSeer;
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,138 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: workerPool.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// CLASS INVARIANT:
+// * The worker threads live as long as the pool and sleep between batches.
+// * At most one batch runs at a time.
+
+// DESCRIPTION:
+// * A fixed set of worker threads that run batches of numbered tasks (a
+// parallel for loop), e.g. the chunks of a parallel numMixer ping.
+
+// ASSUMPTIONS:
+// * A batch of "tasks" tasks calls the task once for every index in
+// [0, tasks). Workers, and the thread that started the batch, claim indexes
+// from a shared atomic counter, so uneven tasks balance themselves.
+// * Which thread runs which index is unspecified; callers that need
+// reproducible results must make each task depend only on its index.
+// * Batches started from several threads at once run one after another.
+// * A pool cannot be copied or moved.
+
+
+#ifndef workerPool_INCLUDED
+#define workerPool_INCLUDED
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <atomic>  // atomic
+#include <condition_variable>  // condition_variable
+#include <functional>  // function
+#include <mutex>  // mutex
+#include <thread>  // thread
+#include <vector>  // vector
+
+
+class workerPool
+{
+	public:
+		// Constructors
+
+		explicit workerPool(std::size_t threads = 0);
+		// DESCRIPTION:
+		// * Creates a pool that runs batches on "threads" threads, counting
+		// the thread that starts a batch. 0 uses one thread per hardware
+		// thread.
+		//
+		// POSTCONDITIONS:
+		// * threads() - 1 worker threads are started.
+
+		workerPool(const workerPool&) = delete;
+		workerPool& operator=(const workerPool&) = delete;
+
+		~workerPool();
+		// DESCRIPTION:
+		// * Stops and joins the worker threads.
+
+
+		// Functionality
+
+		void run(std::size_t tasks,
+		         const std::function<void(std::size_t)>& task);
+		// DESCRIPTION:
+		// * Calls "task" once for every index in [0, "tasks") across the
+		// workers and the calling thread, and returns once every call has
+		// finished.
+		//
+		// PRECONDITIONS:
+		// * "task" must not start a batch on the same pool.
+
+
+		// Accessors
+
+		std::size_t threads() const;
+		// DESCRIPTION:
+		// * Returns the number of threads a batch runs on.
+
+
+	private:
+		// Members
+
+		std::vector<std::thread> _workers;
+		// The worker threads.
+
+		std::mutex _runLock;
+		// Serializes batches.
+
+		std::mutex _lock;
+		// Guards the batch state below.
+
+		std::condition_variable _wake;
+		// Signals the workers that a batch started or the pool is stopping.
+
+		std::condition_variable _finished;
+		// Signals the batch owner that every worker left the batch.
+
+		const std::function<void(std::size_t)>* _task;
+		// The task of the current batch.
+
+		std::size_t _tasks;
+		// The number of tasks in the current batch.
+
+		std::atomic<std::size_t> _next;
+		// The next unclaimed task index.
+
+		std::size_t _busy;
+		// Workers that have not yet left the current batch.
+
+		std::uint64_t _batch;
+		// Counts batches, so workers can tell a new batch from a spurious
+		// wakeup.
+
+		bool _stopping;
+		// Whether the pool is being destroyed.
+
+
+		// Utility
+
+		void work();
+		// DESCRIPTION:
+		// * The worker thread loop: waits for a batch, helps run it and
+		// repeats until the pool stops.
+
+		void drain();
+		// DESCRIPTION:
+		// * Claims and runs tasks of the current batch until none remain.
+};
+
+
+inline std::size_t workerPool::threads() const
+{
+	return _workers.size() + 1;
+}
+
+
+#endif
\ No newline at end of file
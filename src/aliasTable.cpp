@@ -0,0 +1,124 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: aliasTable.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _total is kept up to date by setWeight() and recomputed from scratch on
+// every build, so rounding errors from repeated updates do not accumulate.
+// * Full columns (including the leftovers of Vose's method) alias themselves,
+// so their threshold never matters.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint32_t, uint64_t
+#include <cmath>  // isfinite
+#include <vector>  // vector
+
+
+#include "../include/aliasTable.h"
+
+
+aliasTable::aliasTable():
+	_weights(),
+	_total(0),
+	_columns(),
+	_scaled(),
+	_small(),
+	_large(),
+	_dirty(false)
+{
+}
+
+
+aliasTable::aliasTable(const std::vector<double>& weights):
+	_weights(weights),
+	_total(0),
+	_columns(),
+	_scaled(),
+	_small(),
+	_large(),
+	_dirty(true)
+{
+	for (std::size_t i = 0; i < _weights.size(); ++i) {
+		if (!std::isfinite(_weights[i]) || _weights[i] < 0) {
+			_weights.clear();
+			break;
+		}
+	}
+	build();
+}
+
+
+void aliasTable::build()
+{
+	if (!_dirty) {
+		return;
+	}
+	_dirty = false;
+
+	const std::size_t n = _weights.size();
+	_total = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		_total += _weights[i];
+	}
+	_columns.resize(n);
+	if (empty()) {
+		return;
+	}
+
+	// scale the weights so the average column holds exactly 1
+	_scaled.resize(n);
+	std::vector<double>& scaled = _scaled;
+	_small.clear();
+	_large.clear();
+	for (std::size_t i = 0; i < n; ++i) {
+		scaled[i] = _weights[i] * n / _total;
+		if (scaled[i] < 1) {
+			_small.push_back(i);
+		} else {
+			_large.push_back(i);
+		}
+	}
+
+	// top up every underfull column from an overfull one
+	const double SCALE = 4294967296.0;
+	while (!_small.empty() && !_large.empty()) {
+		const std::uint32_t less = _small.back();
+		const std::uint32_t more = _large.back();
+		_small.pop_back();
+		_columns[less].threshold = static_cast<std::uint32_t>(
+			scaled[less] * SCALE);
+		_columns[less].alias = more;
+		scaled[more] -= 1 - scaled[less];
+		if (scaled[more] < 1) {
+			_large.pop_back();
+			_small.push_back(more);
+		}
+	}
+
+	// whatever is left is full, up to rounding
+	for (std::size_t i = 0; i < _large.size(); ++i) {
+		_columns[_large[i]].threshold = UINT32_MAX;
+		_columns[_large[i]].alias = _large[i];
+	}
+	for (std::size_t i = 0; i < _small.size(); ++i) {
+		_columns[_small[i]].threshold = UINT32_MAX;
+		_columns[_small[i]].alias = _small[i];
+	}
+}
+
+
+bool aliasTable::setWeight(std::size_t i, double weight)
+{
+	if (i >= _weights.size() || !std::isfinite(weight) || weight < 0) {
+		return false;
+	}
+	if (_weights[i] != weight) {
+		_total += weight - _weights[i];
+		_weights[i] = weight;
+		_dirty = true;
+	}
+	return true;
+}
\ No newline at end of file
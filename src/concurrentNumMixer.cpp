@@ -0,0 +1,394 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: concurrentNumMixer.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * Quota only moves from _countDown into a slot (a lease) and out of a slot
+// when a ping spends it. Every move of a single ping is a compare-and-swap on
+// a positive counter, so no ping of quota is spent twice or lost.
+// * _leasesInFlight is raised before a lease leaves _countDown and lowered
+// after it lands in a slot; _leaseCount is bumped in between.
+// * A ping reads _version only between enterRead() and exitRead(), and only
+// dereferences its handle's unowned dataset binding after checking it against
+// that version's generation.
+
+
+#include <ctime>  // time
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <algorithm>  // min
+#include <atomic>  // atomic
+#include <memory>  // make_shared, unique_ptr, align
+#include <mutex>  // mutex, lock_guard
+#include <new>  // placement new
+#include <random>  // mt19937, uniform_int_distribution
+#include <thread>  // this_thread
+#include <vector>  // vector
+
+
+#include "../include/concurrentNumMixer.h"
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+
+
+template <class T, class Engine>
+const int basicConcurrentNumMixer<T, Engine>::_LEASE_SIZE;
+
+
+template <class T, class Engine>
+basicConcurrentNumMixer<T, Engine>::handle::handle(
+	basicConcurrentNumMixer& owner, std::size_t slot, std::uint64_t seed):
+	_owner(&owner),
+	_slot(slot),
+	_mixer(basicNumDatasetHandle<T>()),
+	_generation(0)
+{
+	_mixer.seed(seed);
+}
+
+
+template <class T, class Engine>
+bool basicConcurrentNumMixer<T, Engine>::handle::ping(
+	std::vector<T>& returnValues)
+{
+	std::size_t parity = 0;
+	const version* current = _owner->enterRead(_slot, parity);
+	const OutputController state = _owner->getControllerState();
+	bool pinged = false;
+	if (_owner->checkStateValid(*current, state) && _owner->acquire(_slot)) {
+		if (_generation != current->generation) {
+			// bind without a reference: the version keeps the dataset alive
+			// for as long as a ping can see it
+			_mixer.setDataset(basicNumDatasetHandle<T>(
+				basicNumDatasetHandle<T>(), current->dataset.get()));
+			_generation = current->generation;
+		}
+		_mixer.setControllerState(state);
+		_mixer.genRandNums(returnValues.data(), returnValues.size());
+		pinged = true;
+	}
+	_owner->exitRead(_slot, parity);
+	return pinged;
+}
+
+
+template <class T, class Engine>
+basicConcurrentNumMixer<T, Engine>::basicConcurrentNumMixer(
+	std::size_t slots):
+	_version(nullptr),
+	_epoch(0),
+	_swapLock(),
+	_generation(0),
+	_countDown(0),
+	_slotBuffer(),
+	_slots(nullptr),
+	_slotCount(0),
+	_leasesInFlight(0),
+	_leaseCount(0),
+	_controllerState(MIX),
+	_stateChangeCount(0),
+	_key(time(0)),
+	_nextStream(0),
+	_nextSlot(0)
+{
+	// valid dataset of 1-100, shared by every default concurrentNumMixer
+	const int SIZE = 100;
+	static const basicNumDatasetHandle<T> DEFAULT_DATASET =
+		std::make_shared<const basicNumDataset<T> >(
+			basicNumDataset<T>::arithmetic(1, SIZE));
+	initialize(DEFAULT_DATASET, slots);
+}
+
+
+template <class T, class Engine>
+basicConcurrentNumMixer<T, Engine>::basicConcurrentNumMixer(
+	basicNumDatasetHandle<T> dataset, std::size_t slots):
+	_version(nullptr),
+	_epoch(0),
+	_swapLock(),
+	_generation(0),
+	_countDown(0),
+	_slotBuffer(),
+	_slots(nullptr),
+	_slotCount(0),
+	_leasesInFlight(0),
+	_leaseCount(0),
+	_controllerState(MIX),
+	_stateChangeCount(0),
+	_key(time(0)),
+	_nextStream(0),
+	_nextSlot(0)
+{
+	initialize(dataset, slots);
+}
+
+
+template <class T, class Engine>
+basicConcurrentNumMixer<T, Engine>::~basicConcurrentNumMixer()
+{
+	delete _version.load();
+}
+
+
+template <class T, class Engine>
+typename basicConcurrentNumMixer<T, Engine>::handle
+basicConcurrentNumMixer<T, Engine>::makeHandle()
+{
+	// counter split: the n-th handle's seed is the n-th output of a
+	// splitMix64 keyed with _key
+	splitMix64 streams(_key);
+	streams.discard(_nextStream++);
+	return handle(*this, _nextSlot++ % _slotCount, streams());
+}
+
+
+template <class T, class Engine>
+int basicConcurrentNumMixer<T, Engine>::remaining() const
+{
+	int total = _countDown;
+	for (std::size_t i = 0; i < _slotCount; ++i) {
+		total += _slots[i].quota;
+	}
+	return total;
+}
+
+
+template <class T, class Engine>
+void basicConcurrentNumMixer<T, Engine>::seed(std::uint64_t value)
+{
+	_key = value;
+	_nextStream = 0;
+}
+
+
+template <class T, class Engine>
+std::size_t basicConcurrentNumMixer<T, Engine>::datasetSize() const
+{
+	std::size_t parity = 0;
+	const std::size_t size = enterRead(0, parity)->dataset->size();
+	exitRead(0, parity);
+	return size;
+}
+
+
+template <class T, class Engine>
+basicNumDatasetHandle<T> basicConcurrentNumMixer<T, Engine>::dataset() const
+{
+	std::size_t parity = 0;
+	const basicNumDatasetHandle<T> dataset = enterRead(0, parity)->dataset;
+	exitRead(0, parity);
+	return dataset;
+}
+
+
+template <class T, class Engine>
+void basicConcurrentNumMixer<T, Engine>::setDataset(
+	basicNumDatasetHandle<T> dataset)
+{
+	std::lock_guard<std::mutex> lock(_swapLock);
+	const version* old = _version.exchange(makeVersion(dataset));
+
+	// pings announced on either parity may still hold the old version; a ping
+	// that read the epoch before the first flip but announces itself after
+	// it is caught by the second
+	for (int flip = 0; flip < 2; ++flip) {
+		waitForReaders(_epoch++ & 1);
+	}
+	delete old;
+}
+
+
+template <class T, class Engine>
+void basicConcurrentNumMixer<T, Engine>::setControllerState(
+	OutputController state)
+{
+	if (_controllerState.exchange(state) != state) {
+		++_stateChangeCount;
+	}
+}
+
+
+template <class T, class Engine>
+void basicConcurrentNumMixer<T, Engine>::initialize(
+	basicNumDatasetHandle<T> dataset, std::size_t slots)
+{
+	// publish dataset
+	_version = makeVersion(dataset);
+
+	// create slots
+	_slotCount = (slots > 0) ? slots : 1;
+	std::size_t space = (_slotCount + 1) * sizeof(quotaSlot);
+	_slotBuffer.reset(new char[space]);
+	void* first = _slotBuffer.get();
+	std::align(alignof(quotaSlot), _slotCount * sizeof(quotaSlot), first,
+	           space);
+	_slots = static_cast<quotaSlot*>(first);
+	for (std::size_t i = 0; i < _slotCount; ++i) {
+		new (&_slots[i]) quotaSlot();
+		_slots[i].quota = 0;
+		_slots[i].readers[0] = 0;
+		_slots[i].readers[1] = 0;
+	}
+
+	// calc max ping count
+	const int LOWER_BOUND = 10;
+	const int UPPER_BOUND = 20;
+	std::mt19937 eng(_key);
+	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
+	_countDown = distr(eng);
+}
+
+
+template <class T, class Engine>
+const typename basicConcurrentNumMixer<T, Engine>::version*
+basicConcurrentNumMixer<T, Engine>::makeVersion(
+	basicNumDatasetHandle<T> dataset)
+{
+	version* fresh = new version;
+	fresh->dataset = dataset ? dataset
+	                         : std::make_shared<const basicNumDataset<T> >();
+	fresh->evenValid = (fresh->dataset->evenCount() > 0);
+	fresh->oddValid = (fresh->dataset->oddCount() > 0);
+	fresh->generation = ++_generation;
+	return fresh;
+}
+
+
+template <class T, class Engine>
+const typename basicConcurrentNumMixer<T, Engine>::version*
+basicConcurrentNumMixer<T, Engine>::enterRead(std::size_t slot,
+                                              std::size_t& parity) const
+{
+	parity = _epoch & 1;
+	++_slots[slot].readers[parity];
+	return _version;
+}
+
+
+template <class T, class Engine>
+void basicConcurrentNumMixer<T, Engine>::exitRead(std::size_t slot,
+                                                  std::size_t parity) const
+{
+	--_slots[slot].readers[parity];
+}
+
+
+template <class T, class Engine>
+void basicConcurrentNumMixer<T, Engine>::waitForReaders(
+	std::size_t parity) const
+{
+	for (std::size_t i = 0; i < _slotCount; ++i) {
+		while (_slots[i].readers[parity] > 0) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+template <class T, class Engine>
+bool basicConcurrentNumMixer<T, Engine>::checkStateValid(
+	const version& current, OutputController state) const
+{
+	switch (state) {
+		case MIX:
+			return !current.dataset->empty();
+		case EVEN:
+			return current.evenValid;
+		case ODD:
+			return current.oddValid;
+		default:
+			return false;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicConcurrentNumMixer<T, Engine>::acquire(std::size_t slot)
+{
+	// fast path: the slot's own lease, which other threads rarely touch
+	if (takeOne(_slots[slot].quota)) {
+		return true;
+	}
+
+	while (true) {
+		const std::uint64_t leases = _leaseCount;
+
+		// lease a chunk from the shared countdown, keeping one ping for now
+		++_leasesInFlight;
+		int available = _countDown;
+		while (available > 0) {
+			const int lease = std::min(available, _LEASE_SIZE);
+			if (_countDown.compare_exchange_weak(available,
+			                                     available - lease)) {
+				_slots[slot].quota += lease - 1;
+				++_leaseCount;
+				--_leasesInFlight;
+				return true;
+			}
+		}
+		--_leasesInFlight;
+
+		// the countdown is spent: steal from the other slots
+		for (std::size_t i = 1; i < _slotCount; ++i) {
+			if (takeOne(_slots[(slot + i) % _slotCount].quota)) {
+				return true;
+			}
+		}
+
+		// only give up if no quota can have moved past the scan
+		if (_leasesInFlight == 0 && _leaseCount == leases) {
+			return false;
+		}
+	}
+}
+
+
+template <class T, class Engine>
+bool basicConcurrentNumMixer<T, Engine>::takeOne(std::atomic<int>& quota)
+{
+	int available = quota;
+	while (available > 0) {
+		if (quota.compare_exchange_weak(available, available - 1)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+// supported element types and engines
+template class basicConcurrentNumMixer<std::int8_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::int8_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::int8_t, pcg64>;
+template class basicConcurrentNumMixer<std::int8_t, splitMix64>;
+template class basicConcurrentNumMixer<std::uint8_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::uint8_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::uint8_t, pcg64>;
+template class basicConcurrentNumMixer<std::uint8_t, splitMix64>;
+template class basicConcurrentNumMixer<std::int16_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::int16_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::int16_t, pcg64>;
+template class basicConcurrentNumMixer<std::int16_t, splitMix64>;
+template class basicConcurrentNumMixer<std::uint16_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::uint16_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::uint16_t, pcg64>;
+template class basicConcurrentNumMixer<std::uint16_t, splitMix64>;
+template class basicConcurrentNumMixer<int, std::mt19937>;
+template class basicConcurrentNumMixer<int, xoshiro256ss>;
+template class basicConcurrentNumMixer<int, pcg64>;
+template class basicConcurrentNumMixer<int, splitMix64>;
+template class basicConcurrentNumMixer<std::uint32_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::uint32_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::uint32_t, pcg64>;
+template class basicConcurrentNumMixer<std::uint32_t, splitMix64>;
+template class basicConcurrentNumMixer<std::int64_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::int64_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::int64_t, pcg64>;
+template class basicConcurrentNumMixer<std::int64_t, splitMix64>;
+template class basicConcurrentNumMixer<std::uint64_t, std::mt19937>;
+template class basicConcurrentNumMixer<std::uint64_t, xoshiro256ss>;
+template class basicConcurrentNumMixer<std::uint64_t, pcg64>;
+template class basicConcurrentNumMixer<std::uint64_t, splitMix64>;
\ No newline at end of file
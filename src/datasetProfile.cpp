@@ -0,0 +1,245 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: datasetProfile.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _min and _max are only meaningful while _size > 0; merge() and add()
+// take the other side's bounds as they are when the profile is empty.
+// * Values are hashed with the splitMix64 finalizer, so every bit of the
+// hash depends on every bit of the value.
+// * The registers and the histogram stay zero unless _detailed. _distinct is
+// only set by arithmetic(), whose registers stay zero.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <cmath>  // log, ldexp
+#include <algorithm>  // min, max
+#include <type_traits>  // is_signed, make_unsigned
+
+
+#include "../include/datasetProfile.h"
+#include "../include/rngEngines.h"
+
+
+template <class T>
+const std::size_t basicDatasetProfile<T>::BUCKETS;
+
+
+template <class T>
+basicDatasetProfile<T>::basicDatasetProfile(bool detailed):
+	_detailed(detailed),
+	_size(0),
+	_oddCount(0),
+	_min(),
+	_max(),
+	_distinct(0)
+{
+	std::fill(_registers, _registers + _REGISTERS, 0);
+	std::fill(_histogram, _histogram + BUCKETS, 0);
+}
+
+
+template <class T>
+basicDatasetProfile<T> basicDatasetProfile<T>::arithmetic(T start,
+                                                          std::size_t count,
+                                                          T stride,
+                                                          bool detailed)
+{
+	basicDatasetProfile profile(detailed);
+	if (count == 0) {
+		return profile;
+	}
+
+	// values as the dataset computes them; unsigned so strides wrap
+	const std::uint64_t first = static_cast<std::uint64_t>(start);
+	const std::uint64_t step = static_cast<std::uint64_t>(stride);
+	auto valueAt = [&](std::size_t i) {
+		return static_cast<T>(first + static_cast<std::uint64_t>(i) * step);
+	};
+
+	// an even stride keeps the parity of start, an odd one alternates it
+	const bool startOdd = (first & 1) != 0;
+	profile._size = count;
+	if ((step & 1) == 0) {
+		profile._oddCount = startOdd ? count : 0;
+	} else {
+		profile._oddCount = startOdd ? (count + 1) / 2 : count / 2;
+	}
+
+	// the values are monotonic, so the bounds are the ends
+	const T last = valueAt(count - 1);
+	profile._min = std::min(start, last);
+	profile._max = std::max(start, last);
+	if (!detailed) {
+		return profile;
+	}
+
+	// no value repeats unless the stride is 0
+	profile._distinct = (step != 0) ? count : 1;
+
+	// bucketOf() is monotonic in the value, hence in the position: find
+	// the last position of each bucket met by binary search
+	std::size_t begin = 0;
+	while (begin < count) {
+		const std::size_t b = bucketOf(valueAt(begin));
+		std::size_t low = begin;
+		std::size_t high = count - 1;
+		while (low < high) {
+			const std::size_t middle = low + (high - low + 1) / 2;
+			if (bucketOf(valueAt(middle)) == b) {
+				low = middle;
+			} else {
+				high = middle - 1;
+			}
+		}
+		profile._histogram[b] += low - begin + 1;
+		begin = low + 1;
+	}
+	return profile;
+}
+
+
+template <class T>
+void basicDatasetProfile<T>::add(const T* values, std::size_t count)
+{
+	if (count == 0) {
+		return;
+	}
+
+	// reductions kept free of branches so they vectorize
+	typedef typename std::make_unsigned<T>::type unsignedType;
+	std::size_t odd = 0;
+	T low = values[0];
+	T high = values[0];
+	for (std::size_t i = 0; i < count; ++i) {
+		odd += static_cast<unsignedType>(values[i]) & 1u;
+		low = std::min(low, values[i]);
+		high = std::max(high, values[i]);
+	}
+
+	if (_detailed) {
+		for (std::size_t i = 0; i < count; ++i) {
+			sketch(values[i]);
+			++_histogram[bucketOf(values[i])];
+		}
+	}
+
+	_min = (_size > 0) ? std::min(_min, low) : low;
+	_max = (_size > 0) ? std::max(_max, high) : high;
+	_size += count;
+	_oddCount += odd;
+}
+
+
+template <class T>
+void basicDatasetProfile<T>::add(T value)
+{
+	add(&value, 1);
+}
+
+
+template <class T>
+void basicDatasetProfile<T>::remove(T value)
+{
+	typedef typename std::make_unsigned<T>::type unsignedType;
+	--_size;
+	_oddCount -= static_cast<unsignedType>(value) & 1u;
+	if (_detailed) {
+		--_histogram[bucketOf(value)];
+	}
+}
+
+
+template <class T>
+void basicDatasetProfile<T>::merge(const basicDatasetProfile& other)
+{
+	if (other._size == 0) {
+		return;
+	}
+	_min = (_size > 0) ? std::min(_min, other._min) : other._min;
+	_max = (_size > 0) ? std::max(_max, other._max) : other._max;
+	_size += other._size;
+	_oddCount += other._oddCount;
+	if (_detailed) {
+		for (std::size_t r = 0; r < _REGISTERS; ++r) {
+			_registers[r] = std::max(_registers[r], other._registers[r]);
+		}
+		for (std::size_t b = 0; b < BUCKETS; ++b) {
+			_histogram[b] += other._histogram[b];
+		}
+	}
+}
+
+
+template <class T>
+std::size_t basicDatasetProfile<T>::bucketOf(T value)
+{
+	// branch free, since signs are often unpredictable: for negative values
+	// sign is all ones, the magnitude becomes -1 - value and the bucket
+	// 64 + ~width, i.e. 63 - width
+	const std::size_t ZERO_BUCKET = 64;
+	const std::uint64_t sign = std::is_signed<T>::value
+		? static_cast<std::uint64_t>(static_cast<std::int64_t>(value) >> 63)
+		: 0;
+	const std::uint64_t magnitude = static_cast<std::uint64_t>(value) ^ sign;
+	const std::uint64_t width = 64 - __builtin_clzll(magnitude | 1)
+	                            - (magnitude == 0);
+	return ZERO_BUCKET + (width ^ sign);
+}
+
+
+template <class T>
+std::size_t basicDatasetProfile<T>::distinctEstimate() const
+{
+	if (_size == 0) {
+		return 0;
+	} else if (_distinct > 0) {
+		return _distinct;
+	}
+
+	double harmonic = 0;
+	std::size_t zeros = 0;
+	for (std::size_t r = 0; r < _REGISTERS; ++r) {
+		harmonic += std::ldexp(1.0, -static_cast<int>(_registers[r]));
+		zeros += (_registers[r] == 0);
+	}
+	const double m = static_cast<double>(_REGISTERS);
+	const double alpha = 0.7213 / (1 + 1.079 / m);
+	double estimate = alpha * m * m / harmonic;
+
+	// linear counting is more accurate while many registers are unset
+	if (estimate <= 2.5 * m && zeros > 0) {
+		estimate = m * std::log(m / zeros);
+	}
+	return std::min(_size, static_cast<std::size_t>(estimate + 0.5));
+}
+
+
+template <class T>
+void basicDatasetProfile<T>::sketch(T value)
+{
+	splitMix64 hasher(static_cast<std::uint64_t>(value));
+	const std::uint64_t hash = hasher();
+	const std::size_t r = hash >> (64 - _REGISTER_BITS);
+
+	// leading zeros of the remaining bits plus one; the guard bit caps the
+	// rank at 64 - _REGISTER_BITS + 1 without a branch
+	const std::uint64_t rest = (hash << _REGISTER_BITS)
+	                           | (1ULL << (_REGISTER_BITS - 1));
+	const std::uint8_t rank = __builtin_clzll(rest) + 1;
+	_registers[r] = std::max(_registers[r], rank);
+}
+
+
+// supported element types
+template class basicDatasetProfile<std::int8_t>;
+template class basicDatasetProfile<std::uint8_t>;
+template class basicDatasetProfile<std::int16_t>;
+template class basicDatasetProfile<std::uint16_t>;
+template class basicDatasetProfile<int>;
+template class basicDatasetProfile<std::uint32_t>;
+template class basicDatasetProfile<std::int64_t>;
+template class basicDatasetProfile<std::uint64_t>;
\ No newline at end of file
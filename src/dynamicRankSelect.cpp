@@ -0,0 +1,179 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: dynamicRankSelect.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _tree has one entry per 512-bit block plus the unused entry 0, and _ones
+// is the total it holds.
+// * Bits past _size in the last word are always unset.
+// * A Fenwick entry only covers blocks at or before its own, so dropping the
+// entries of trailing blocks leaves the rest valid.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // int64_t, uint64_t
+#include <algorithm>  // fill, min
+#include <vector>  // vector
+
+
+#include "../include/dynamicRankSelect.h"
+#include "../include/rankSelect.h"
+
+
+dynamicRankSelect::dynamicRankSelect():
+	_size(0),
+	_ones(0),
+	_words(),
+	_tree(1, 0)
+{
+}
+
+
+dynamicRankSelect::dynamicRankSelect(std::size_t size):
+	_size(size),
+	_ones(0),
+	_words((size + 63) / 64, 0),
+	_tree((_words.size() + _BLOCK_WORDS - 1) / _BLOCK_WORDS + 1, 0)
+{
+}
+
+
+void dynamicRankSelect::set(std::size_t pos)
+{
+	const std::uint64_t bit = 1ULL << (pos & 63);
+	if (!(_words[pos >> 6] & bit)) {
+		_words[pos >> 6] |= bit;
+		add(pos / (_BLOCK_WORDS * 64), 1);
+	}
+}
+
+
+void dynamicRankSelect::reset(std::size_t pos)
+{
+	const std::uint64_t bit = 1ULL << (pos & 63);
+	if (_words[pos >> 6] & bit) {
+		_words[pos >> 6] &= ~bit;
+		add(pos / (_BLOCK_WORDS * 64), -1);
+	}
+}
+
+
+void dynamicRankSelect::resize(std::size_t size)
+{
+	const std::size_t words = (size + 63) / 64;
+	const std::size_t blocks = (words + _BLOCK_WORDS - 1) / _BLOCK_WORDS;
+	if (size < _size) {
+		// drop the trailing blocks, then recount the new last one
+		_tree.resize(blocks + 1);
+		_words.resize(words);
+		if (size & 63) {
+			_words.back() &= (1ULL << (size & 63)) - 1;
+		}
+		_ones = prefix(blocks);
+		if (blocks > 0) {
+			std::int64_t count = 0;
+			for (std::size_t w = (blocks - 1) * _BLOCK_WORDS; w < words; ++w) {
+				count += __builtin_popcountll(_words[w]);
+			}
+			add(blocks - 1, count - static_cast<std::int64_t>(
+				prefix(blocks) - prefix(blocks - 1)));
+		}
+	} else {
+		// each new block is empty: its entry sums the blocks it covers
+		_words.resize(words, 0);
+		for (std::size_t i = _tree.size(); i <= blocks; ++i) {
+			_tree.push_back(prefix(i - 1) - prefix(i - (i & (0 - i))));
+		}
+	}
+	_size = size;
+}
+
+
+void dynamicRankSelect::build()
+{
+	const std::size_t blocks = _tree.size() - 1;
+	std::fill(_tree.begin(), _tree.end(), 0);
+	for (std::size_t b = 0; b < blocks; ++b) {
+		const std::size_t end = std::min(_words.size(), (b + 1) * _BLOCK_WORDS);
+		for (std::size_t w = b * _BLOCK_WORDS; w < end; ++w) {
+			_tree[b + 1] += __builtin_popcountll(_words[w]);
+		}
+	}
+
+	// push each entry's count up to the entry covering it, in O(blocks)
+	for (std::size_t i = 1; i <= blocks; ++i) {
+		const std::size_t parent = i + (i & (0 - i));
+		if (parent <= blocks) {
+			_tree[parent] += _tree[i];
+		}
+	}
+	_ones = prefix(blocks);
+}
+
+
+std::size_t dynamicRankSelect::rank1(std::size_t pos) const
+{
+	const std::size_t block = pos / (_BLOCK_WORDS * 64);
+	std::size_t rank = prefix(block);
+	const std::size_t word = pos >> 6;
+	for (std::size_t w = block * _BLOCK_WORDS; w < word; ++w) {
+		rank += __builtin_popcountll(_words[w]);
+	}
+	if (pos & 63) {
+		const std::uint64_t mask = (1ULL << (pos & 63)) - 1;
+		rank += __builtin_popcountll(_words[word] & mask);
+	}
+	return rank;
+}
+
+
+std::size_t dynamicRankSelect::select1(std::size_t j) const
+{
+	// descend the tree to the block holding the j-th set bit
+	const std::size_t blocks = _tree.size() - 1;
+	std::size_t block = 0;
+	std::size_t remaining = j;
+	for (std::size_t step = std::size_t(1) << (63 - __builtin_clzll(blocks));
+	     step > 0; step >>= 1) {
+		if (block + step <= blocks && _tree[block + step] <= remaining) {
+			block += step;
+			remaining -= _tree[block];
+		}
+	}
+
+	// scan the block's words
+	for (std::size_t w = block * _BLOCK_WORDS; ; ++w) {
+		const std::size_t count = __builtin_popcountll(_words[w]);
+		if (remaining < count) {
+			return w * 64 + rankSelect::selectInWord(_words[w], remaining);
+		}
+		remaining -= count;
+	}
+}
+
+
+std::size_t dynamicRankSelect::memoryUsage() const
+{
+	return (_words.size() + _tree.size()) * sizeof(std::uint64_t);
+}
+
+
+void dynamicRankSelect::add(std::size_t block, std::int64_t delta)
+{
+	for (std::size_t i = block + 1; i < _tree.size(); i += i & (0 - i)) {
+		_tree[i] += delta;
+	}
+	_ones += delta;
+}
+
+
+std::size_t dynamicRankSelect::prefix(std::size_t blocks) const
+{
+	std::size_t count = 0;
+	for (std::size_t i = blocks; i > 0; i -= i & (0 - i)) {
+		count += _tree[i];
+	}
+	return count;
+}
\ No newline at end of file
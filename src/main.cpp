@@ -233,11 +233,11 @@ void pingMixer(numMixer* numMixerObj,
 	}
 
 	const int SIZE = 10;
-	std::vector<int> pingedData(SIZE);
-	if (numMixerObj->ping(pingedData)) {
+	numMixer::generator pingedData;
+	if (numMixerObj->ping(SIZE, pingedData)) {
 		ofs << "Ping successful (" << SIZE << " elements requested):"
 		    << std::endl;
-		for (auto& num : pingedData) {
+		for (int num : pingedData) {
 			ofs << num << std::endl;
 		}
 	} else {
@@ -0,0 +1,175 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: mappedFile.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _data is null whenever nothing is mapped.
+// * The file descriptor/handle is closed as soon as the mapping exists; the
+// mapping keeps the file alive.
+
+
+#include <cstddef>  // size_t
+#include <string>  // string
+
+
+#if defined(_WIN32)
+#include <windows.h>  // CreateFileA, CreateFileMappingA, MapViewOfFile
+#else
+#include <fcntl.h>  // open
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <sys/stat.h>  // fstat
+#include <unistd.h>  // close
+#endif
+
+
+#include "../include/mappedFile.h"
+
+
+mappedFile::mappedFile():
+	_data(nullptr),
+	_size(0),
+	_mapping(nullptr)
+{
+}
+
+
+mappedFile::mappedFile(mappedFile&& other):
+	_data(other._data),
+	_size(other._size),
+	_mapping(other._mapping)
+{
+	other._data = nullptr;
+	other._size = 0;
+	other._mapping = nullptr;
+}
+
+
+mappedFile& mappedFile::operator=(mappedFile&& other)
+{
+	if (this != &other) {
+		close();
+		_data = other._data;
+		_size = other._size;
+		_mapping = other._mapping;
+		other._data = nullptr;
+		other._size = 0;
+		other._mapping = nullptr;
+	}
+	return *this;
+}
+
+
+mappedFile::~mappedFile()
+{
+	close();
+}
+
+
+#if defined(_WIN32)
+
+bool mappedFile::open(const std::string& path, int flags)
+{
+	close();
+
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+	                          nullptr, OPEN_EXISTING,
+	                          FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+	                                    nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr) {
+		return false;
+	}
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		return false;
+	}
+
+	// prefaulting and huge pages are not supported for file views
+	(void)flags;
+	_data = view;
+	_size = static_cast<std::size_t>(fileSize.QuadPart);
+	_mapping = mapping;
+	return true;
+}
+
+
+void mappedFile::close()
+{
+	if (_data != nullptr) {
+		UnmapViewOfFile(_data);
+		CloseHandle(static_cast<HANDLE>(_mapping));
+	}
+	_data = nullptr;
+	_size = 0;
+	_mapping = nullptr;
+}
+
+#else
+
+bool mappedFile::open(const std::string& path, int flags)
+{
+	close();
+
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+		::close(fd);
+		return false;
+	}
+	const std::size_t size = static_cast<std::size_t>(info.st_size);
+
+	int mapFlags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+	if (flags & PREFAULT) {
+		mapFlags |= MAP_POPULATE;
+	}
+#endif
+	void* view = mmap(nullptr, size, PROT_READ, mapFlags, fd, 0);
+	::close(fd);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+
+#if !defined(MAP_POPULATE) && defined(MADV_WILLNEED)
+	if (flags & PREFAULT) {
+		madvise(view, size, MADV_WILLNEED);
+	}
+#endif
+#if defined(MADV_HUGEPAGE)
+	if (flags & HUGE_PAGES) {
+		madvise(view, size, MADV_HUGEPAGE);
+	}
+#endif
+
+	_data = view;
+	_size = size;
+	return true;
+}
+
+
+void mappedFile::close()
+{
+	if (_data != nullptr) {
+		munmap(_data, _size);
+	}
+	_data = nullptr;
+	_size = 0;
+	_mapping = nullptr;
+}
+
+#endif
\ No newline at end of file
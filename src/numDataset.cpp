@@ -0,0 +1,660 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: numDataset.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _external is null exactly when the values are owned and partitioned, or
+// arithmetic.
+// Ordered datasets point it at _values, which stays valid when the dataset
+// is moved since moving a vector keeps its buffer.
+// * Owned values are partitioned once at construction, unless ordered().
+// Copied values keep their relative order within each parity class.
+// * Slices never share a word of the parity bitmap, so slices can write their
+// words concurrently.
+// * The parity bitmap is only built when _external is set, by the first
+// requireParity() call. Until then _evenCount, _parity and _profile are not
+// read for external values, and after it they never change.
+// * Arithmetic datasets only use _start, _stride and the parity positions;
+// _values stays empty.
+// * _detailedProfile and _sortedIndex are only created by their first
+// request, under std::call_once; only mutations, which require an unshared
+// dataset, change them afterwards.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <algorithm>  // min, max, partition, sort, inplace_merge, fill_n
+#include <atomic>  // memory_order_release
+#include <functional>  // function
+#include <memory>  // unique_ptr
+#include <string>  // string
+#include <thread>  // thread
+#include <type_traits>  // make_unsigned
+#include <utility>  // move, swap
+#include <vector>  // vector
+
+
+#include "../include/datasetProfile.h"
+#include "../include/mappedFile.h"
+#include "../include/numDataset.h"
+#include "../include/rankSelect.h"
+#include "../include/sortedIndex.h"
+#include "../include/workerPool.h"
+
+
+static std::size_t sliceCount(std::size_t count);
+
+static void runSlices(workerPool* pool, std::size_t count, std::size_t slices,
+                      const std::function<void(std::size_t, std::size_t,
+                                               std::size_t)>& task);
+
+template <class T>
+static std::uint64_t parityWord(const T* values, std::size_t count);
+
+template <class T>
+static void mergeRuns(std::vector<T>& values,
+                      const std::vector<std::size_t>& bounds,
+                      workerPool& pool);
+
+
+template <class T>
+basicNumDataset<T>::basicNumDataset():
+	_values(),
+	_mapping(),
+	_external(nullptr),
+	_size(0),
+	_evenCount(0),
+	_parity(),
+	_arithmetic(false),
+	_start(0),
+	_stride(0),
+	_evenFirst(0),
+	_oddFirst(0),
+	_parityStep(1),
+	_profile(),
+	_detailedProfile(),
+	_sortedIndex(),
+	_deferred(new deferredPasses)
+{
+}
+
+
+template <class T>
+basicNumDataset<T>::basicNumDataset(const std::vector<T>& values):
+	_values(),
+	_mapping(),
+	_external(nullptr),
+	_size(values.size()),
+	_evenCount(0),
+	_parity(),
+	_arithmetic(false),
+	_start(0),
+	_stride(0),
+	_evenFirst(0),
+	_oddFirst(0),
+	_parityStep(1),
+	_profile(),
+	_detailedProfile(),
+	_sortedIndex(),
+	_deferred(new deferredPasses)
+{
+	partitionFrom(values);
+}
+
+
+template <class T>
+basicNumDataset<T>::basicNumDataset(std::vector<T>&& values):
+	_values(std::move(values)),
+	_mapping(),
+	_external(nullptr),
+	_size(_values.size()),
+	_evenCount(0),
+	_parity(),
+	_arithmetic(false),
+	_start(0),
+	_stride(0),
+	_evenFirst(0),
+	_oddFirst(0),
+	_parityStep(1),
+	_profile(),
+	_detailedProfile(),
+	_sortedIndex(),
+	_deferred(new deferredPasses)
+{
+	partitionValues();
+}
+
+
+template <class T>
+basicNumDataset<T>::basicNumDataset(
+	std::vector<T>&& values, const basicDatasetProfile<T>& profile):
+	_values(std::move(values)),
+	_mapping(),
+	_external(nullptr),
+	_size(_values.size()),
+	_evenCount(profile.evenCount()),
+	_parity(),
+	_arithmetic(false),
+	_start(0),
+	_stride(0),
+	_evenFirst(0),
+	_oddFirst(0),
+	_parityStep(1),
+	_profile(profile),
+	_detailedProfile(),
+	_sortedIndex(),
+	_deferred(new deferredPasses)
+{
+}
+
+
+template <class T>
+basicNumDataset<T>::basicNumDataset(const T* data, std::size_t size):
+	_values(),
+	_mapping(),
+	_external(data),
+	_size(size),
+	_evenCount(0),
+	_parity(),
+	_arithmetic(false),
+	_start(0),
+	_stride(0),
+	_evenFirst(0),
+	_oddFirst(0),
+	_parityStep(1),
+	_profile(),
+	_detailedProfile(),
+	_sortedIndex(),
+	_deferred(new deferredPasses)
+{
+}
+
+
+template <class T>
+basicNumDataset<T>::basicNumDataset(const std::string& path,
+                                    int mapFlags):
+	_values(),
+	_mapping(),
+	_external(nullptr),
+	_size(0),
+	_evenCount(0),
+	_parity(),
+	_arithmetic(false),
+	_start(0),
+	_stride(0),
+	_evenFirst(0),
+	_oddFirst(0),
+	_parityStep(1),
+	_profile(),
+	_detailedProfile(),
+	_sortedIndex(),
+	_deferred(new deferredPasses)
+{
+	if (!_mapping.open(path, mapFlags)) {
+		return;
+	}
+	_external = static_cast<const T*>(_mapping.data());
+	_size = _mapping.size() / sizeof(T);
+}
+
+
+template <class T>
+basicNumDataset<T> basicNumDataset<T>::ordered(std::vector<T>&& values)
+{
+	basicNumDataset dataset;
+	dataset._values = std::move(values);
+	dataset._external = dataset._values.data();
+	dataset._size = dataset._values.size();
+	return dataset;
+}
+
+
+template <class T>
+basicNumDataset<T> basicNumDataset<T>::arithmetic(T start,
+                                                  std::size_t count,
+                                                  T stride)
+{
+	basicNumDataset dataset;
+	dataset._arithmetic = true;
+	dataset._start = static_cast<std::uint64_t>(start);
+	dataset._stride = static_cast<std::uint64_t>(stride);
+	dataset._size = count;
+
+	const std::size_t startOdd = parityTraits<T>::isOdd(start) ? 1 : 0;
+	if (!parityTraits<T>::isOdd(stride)) {
+		// every value shares the parity of start
+		dataset._parityStep = 1;
+		dataset._evenCount = startOdd ? 0 : count;
+	} else {
+		// parity alternates, starting with the parity of start
+		dataset._parityStep = 2;
+		dataset._evenFirst = startOdd;
+		dataset._oddFirst = 1 - startOdd;
+		dataset._evenCount = (count > startOdd) ? (count - startOdd + 1) / 2
+		                                        : 0;
+	}
+	dataset._profile = basicDatasetProfile<T>::arithmetic(start, count,
+	                                                      stride, false);
+	return dataset;
+}
+
+
+template <class T>
+std::vector<T> basicNumDataset<T>::toVector() const
+{
+	if (!_arithmetic) {
+		return std::vector<T>(data(), data() + _size);
+	}
+	std::vector<T> values(_size);
+	for (std::size_t i = 0; i < _size; ++i) {
+		values[i] = at(i);
+	}
+	return values;
+}
+
+
+template <class T>
+std::vector<T> basicNumDataset<T>::toPartitionedVector() const
+{
+	if (contiguous()) {
+		return _values;
+	}
+	std::vector<T> values;
+	values.reserve(_size);
+	for (std::size_t j = 0; j < evenCount(); ++j) {
+		values.push_back(evenAt(j));
+	}
+	for (std::size_t j = 0; j < oddCount(); ++j) {
+		values.push_back(oddAt(j));
+	}
+	return values;
+}
+
+
+template <class T>
+std::size_t basicNumDataset<T>::partitionedIndex(std::size_t i) const
+{
+	if (contiguous()) {
+		return i;
+	} else if (_arithmetic) {
+		if (parityTraits<T>::isOdd(at(i))) {
+			return _evenCount + (i - _oddFirst) / _parityStep;
+		} else {
+			return (i - _evenFirst) / _parityStep;
+		}
+	} else {
+		requireParity();
+		const std::size_t oddsBefore = _parity.rank1(i);
+		if (_parity.test(i)) {
+			return _evenCount + oddsBefore;
+		} else {
+			return i - oddsBefore;
+		}
+	}
+}
+
+
+template <class T>
+void basicNumDataset<T>::append(T value)
+{
+	_profile.add(value);
+	if (_detailedProfile) {
+		_detailedProfile->add(value);
+	}
+	if (_sortedIndex) {
+		_sortedIndex->insert(value);
+	}
+	_values.push_back(value);
+	if (!parityTraits<T>::isOdd(value)) {
+		// the first odd value makes room at the end of the evens
+		std::swap(_values[_evenCount], _values[_size]);
+		++_evenCount;
+	}
+	++_size;
+}
+
+
+template <class T>
+void basicNumDataset<T>::remove(std::size_t i)
+{
+	_profile.remove(_values[i]);
+	if (_detailedProfile) {
+		_detailedProfile->remove(_values[i]);
+	}
+	if (_sortedIndex) {
+		_sortedIndex->erase(_values[i]);
+	}
+	if (i < _evenCount) {
+		// fill the gap with the last even, then that slot with the last odd
+		--_evenCount;
+		_values[i] = _values[_evenCount];
+		_values[_evenCount] = _values[_size - 1];
+	} else {
+		_values[i] = _values[_size - 1];
+	}
+	_values.pop_back();
+	--_size;
+}
+
+
+template <class T>
+void basicNumDataset<T>::update(std::size_t i, T value)
+{
+	if (parityTraits<T>::isOdd(value) == (i >= _evenCount)) {
+		_profile.remove(_values[i]);
+		_profile.add(value);
+		if (_detailedProfile) {
+			_detailedProfile->remove(_values[i]);
+			_detailedProfile->add(value);
+		}
+		if (_sortedIndex) {
+			_sortedIndex->erase(_values[i]);
+			_sortedIndex->insert(value);
+		}
+		_values[i] = value;
+	} else {
+		remove(i);
+		append(value);
+	}
+}
+
+
+template <class T>
+const basicDatasetProfile<T>& basicNumDataset<T>::detailedProfile() const
+{
+	std::call_once(_deferred->detail, &basicNumDataset::profileDetails, this);
+	return *_detailedProfile;
+}
+
+
+template <class T>
+void basicNumDataset<T>::copySortedIndex(const basicNumDataset& other)
+{
+	if (other.hasSortedIndex()) {
+		std::call_once(_deferred->sorted, [&] {
+			_sortedIndex.reset(new basicSortedIndex<T>(*other._sortedIndex));
+			_deferred->sortedDone.store(true, std::memory_order_release);
+		});
+	}
+}
+
+
+template <class T>
+void basicNumDataset<T>::partitionValues()
+{
+	// profile in parallel, then partition in place
+	const std::size_t slices = sliceCount(_size);
+	std::unique_ptr<workerPool> pool(slices > 1 ? new workerPool : nullptr);
+	std::vector<basicDatasetProfile<T> > profiles(slices);
+	runSlices(pool.get(), _size, slices,
+	          [&](std::size_t slice, std::size_t begin, std::size_t end) {
+		profiles[slice].add(_values.data() + begin, end - begin);
+	});
+	mergeProfiles(profiles);
+
+	std::partition(_values.begin(), _values.end(), [](T val) {
+		return !parityTraits<T>::isOdd(val);
+	});
+}
+
+
+template <class T>
+void basicNumDataset<T>::partitionFrom(const std::vector<T>& values)
+{
+	// first pass: profile each slice, which counts its evens
+	const std::size_t slices = sliceCount(_size);
+	std::unique_ptr<workerPool> pool(slices > 1 ? new workerPool : nullptr);
+	std::vector<basicDatasetProfile<T> > profiles(slices);
+	runSlices(pool.get(), _size, slices,
+	          [&](std::size_t slice, std::size_t begin, std::size_t end) {
+		profiles[slice].add(values.data() + begin, end - begin);
+	});
+	mergeProfiles(profiles);
+
+	// second pass: each slice copies its evens and odds to its own offsets,
+	// a stable partition whatever the number of slices
+	std::vector<std::size_t> evenOffsets(slices);
+	std::vector<std::size_t> oddOffsets(slices);
+	std::size_t evens = 0;
+	std::size_t odds = _evenCount;
+	for (std::size_t slice = 0; slice < slices; ++slice) {
+		evenOffsets[slice] = evens;
+		oddOffsets[slice] = odds;
+		evens += profiles[slice].evenCount();
+		odds += profiles[slice].oddCount();
+	}
+	_values.resize(_size);
+	runSlices(pool.get(), _size, slices,
+	          [&](std::size_t slice, std::size_t begin, std::size_t end) {
+		T* even = _values.data() + evenOffsets[slice];
+		T* odd = _values.data() + oddOffsets[slice];
+		for (std::size_t i = begin; i < end; ++i) {
+			if (parityTraits<T>::isOdd(values[i])) {
+				*odd++ = values[i];
+			} else {
+				*even++ = values[i];
+			}
+		}
+	});
+}
+
+
+template <class T>
+void basicNumDataset<T>::indexParity() const
+{
+	// one streaming pass, in cache-sized blocks, to profile the values and
+	// mark the odd ones a bitmap word at a time
+	const std::size_t BLOCK_SIZE = 4096;
+	const std::size_t slices = sliceCount(_size);
+	std::unique_ptr<workerPool> pool(slices > 1 ? new workerPool : nullptr);
+	std::vector<basicDatasetProfile<T> > profiles(slices);
+	_parity = rankSelect(_size);
+	runSlices(pool.get(), _size, slices,
+	          [&](std::size_t slice, std::size_t begin, std::size_t end) {
+		for (std::size_t block = begin; block < end; block += BLOCK_SIZE) {
+			const std::size_t blockEnd = std::min(end, block + BLOCK_SIZE);
+			profiles[slice].add(_external + block, blockEnd - block);
+			for (std::size_t w = block; w < blockEnd; w += 64) {
+				const std::size_t count = std::min(blockEnd - w,
+				                                   std::size_t(64));
+				_parity.setWord(w / 64, parityWord(_external + w, count));
+			}
+		}
+	});
+	_parity.build();
+	mergeProfiles(profiles);
+	_deferred->parityDone.store(true, std::memory_order_release);
+}
+
+
+template <class T>
+void basicNumDataset<T>::profileDetails() const
+{
+	if (_arithmetic) {
+		_detailedProfile.reset(new basicDatasetProfile<T>(
+			basicDatasetProfile<T>::arithmetic(static_cast<T>(_start), _size,
+			                                   static_cast<T>(_stride),
+			                                   true)));
+		return;
+	}
+
+	// storage order does not matter, so any layout is sliced the same way
+	const std::size_t slices = sliceCount(_size);
+	std::unique_ptr<workerPool> pool(slices > 1 ? new workerPool : nullptr);
+	std::vector<basicDatasetProfile<T> > profiles(
+		slices, basicDatasetProfile<T>(true));
+	runSlices(pool.get(), _size, slices,
+	          [&](std::size_t slice, std::size_t begin, std::size_t end) {
+		profiles[slice].add(data() + begin, end - begin);
+	});
+	_detailedProfile.reset(new basicDatasetProfile<T>(true));
+	for (std::size_t slice = 0; slice < slices; ++slice) {
+		_detailedProfile->merge(profiles[slice]);
+	}
+}
+
+
+template <class T>
+void basicNumDataset<T>::sortValues(workerPool* pool) const
+{
+	std::unique_ptr<workerPool> ownPool(pool ? nullptr : new workerPool);
+	workerPool& workers = pool ? *pool : *ownPool;
+
+	// split the values into one slice per thread
+	const std::size_t slices = std::max<std::size_t>(
+		1, std::min(workers.threads(), _size));
+	std::vector<std::size_t> bounds(slices + 1);
+	for (std::size_t i = 0; i <= slices; ++i) {
+		bounds[i] = _size / slices * i + std::min(i, _size % slices);
+	}
+
+	// the profile tells whether the values span few enough integers to
+	// count them instead of comparing them
+	const basicDatasetProfile<T>& summary = profile();
+	const std::uint64_t COUNTING_SPAN = 1 << 16;
+	const std::uint64_t low = static_cast<std::uint64_t>(summary.min());
+	const std::uint64_t span = _size ? static_cast<std::uint64_t>(
+		summary.max()) - low : 0;
+	std::vector<T> sorted(_size);
+	if (_size > 0 && span < COUNTING_SPAN && span < _size) {
+		// count each slice's values in parallel, then write them out in order
+		std::vector<std::vector<std::size_t> > counts(slices);
+		workers.run(slices, [&](std::size_t slice) {
+			counts[slice].assign(span + 1, 0);
+			for (std::size_t i = bounds[slice]; i < bounds[slice + 1]; ++i) {
+				++counts[slice][static_cast<std::uint64_t>(at(i)) - low];
+			}
+		});
+		typename std::vector<T>::iterator out = sorted.begin();
+		for (std::uint64_t v = 0; v <= span; ++v) {
+			std::size_t count = 0;
+			for (std::size_t slice = 0; slice < slices; ++slice) {
+				count += counts[slice][v];
+			}
+			out = std::fill_n(out, count, static_cast<T>(low + v));
+		}
+	} else {
+		// copy and sort the slices in parallel, then merge them
+		workers.run(slices, [&](std::size_t slice) {
+			for (std::size_t i = bounds[slice]; i < bounds[slice + 1]; ++i) {
+				sorted[i] = at(i);
+			}
+			std::sort(sorted.begin() + bounds[slice],
+			          sorted.begin() + bounds[slice + 1]);
+		});
+		mergeRuns(sorted, bounds, workers);
+	}
+
+	_sortedIndex.reset(new basicSortedIndex<T>(sorted));
+	_deferred->sortedDone.store(true, std::memory_order_release);
+}
+
+
+template <class T>
+void basicNumDataset<T>::mergeProfiles(
+	const std::vector<basicDatasetProfile<T> >& profiles) const
+{
+	_profile = basicDatasetProfile<T>();
+	for (std::size_t slice = 0; slice < profiles.size(); ++slice) {
+		_profile.merge(profiles[slice]);
+	}
+	_evenCount = _profile.evenCount();
+}
+
+
+// supported element types
+template class basicNumDataset<std::int8_t>;
+template class basicNumDataset<std::uint8_t>;
+template class basicNumDataset<std::int16_t>;
+template class basicNumDataset<std::uint16_t>;
+template class basicNumDataset<int>;
+template class basicNumDataset<std::uint32_t>;
+template class basicNumDataset<std::int64_t>;
+template class basicNumDataset<std::uint64_t>;
+
+static std::size_t sliceCount(std::size_t count)
+{
+	const std::size_t PARALLEL_COUNT = 1 << 20;
+	const std::size_t SLICES_PER_THREAD = 4;
+	if (count < PARALLEL_COUNT) {
+		return 1;
+	}
+	const std::size_t threads = std::thread::hardware_concurrency();
+	return SLICES_PER_THREAD * ((threads > 0) ? threads : 1);
+}
+// DESCRIPTION:
+// * Returns how many slices to ingest "count" values in: 1 (on the calling
+// thread) below 2^20 values, otherwise a few per hardware thread so uneven
+// slices balance out.
+
+
+static void runSlices(workerPool* pool, std::size_t count, std::size_t slices,
+                      const std::function<void(std::size_t, std::size_t,
+                                               std::size_t)>& task)
+{
+	// slice bounds fall on multiples of 64, so no two slices share a word
+	// of a bitmap over the values
+	const std::size_t words = (count + 63) / 64;
+	auto run = [&](std::size_t slice) {
+		const std::size_t begin = std::min(count, words * slice / slices * 64);
+		const std::size_t end = std::min(count,
+		                                 words * (slice + 1) / slices * 64);
+		task(slice, begin, end);
+	};
+	if (pool) {
+		pool->run(slices, run);
+	} else {
+		for (std::size_t slice = 0; slice < slices; ++slice) {
+			run(slice);
+		}
+	}
+}
+// DESCRIPTION:
+// * Calls "task"(slice, begin, end) for each of "slices" contiguous slices of
+// [0, "count"), on "pool" or, if it is null, on the calling thread.
+
+
+template <class T>
+static std::uint64_t parityWord(const T* values, std::size_t count)
+{
+	typedef typename std::make_unsigned<T>::type unsignedType;
+	std::uint64_t word = 0;
+	for (std::size_t k = 0; k < count; ++k) {
+		word |= static_cast<std::uint64_t>(
+			static_cast<unsignedType>(values[k]) & 1u) << k;
+	}
+	return word;
+}
+// DESCRIPTION:
+// * Returns a bitmap word with bit k set if "values"[k] is odd, for the
+// "count" (at most 64) values at "values".
+
+
+template <class T>
+static void mergeRuns(std::vector<T>& values,
+                      const std::vector<std::size_t>& bounds,
+                      workerPool& pool)
+{
+	// merge neighbouring runs pairwise, doubling the run width every round
+	const std::size_t runs = bounds.size() - 1;
+	for (std::size_t width = 1; width < runs; width *= 2) {
+		pool.run((runs + 2 * width - 1) / (2 * width), [&](std::size_t pair) {
+			const std::size_t left = 2 * width * pair;
+			const std::size_t middle = left + width;
+			if (middle < runs) {
+				const std::size_t right = std::min(middle + width, runs);
+				std::inplace_merge(values.begin() + bounds[left],
+				                   values.begin() + bounds[middle],
+				                   values.begin() + bounds[right]);
+			}
+		});
+	}
+}
+// DESCRIPTION:
+// * Merges the sorted runs of "values" delimited by "bounds" into one sorted
+// sequence, merging independent pairs of runs in parallel on "pool".
+//
+// PRECONDITIONS:
+// * values[bounds[i], bounds[i + 1]) must be sorted for every i.
\ No newline at end of file
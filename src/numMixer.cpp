@@ -6,82 +6,347 @@
 
 
 #include <ctime>  // time
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t, UINT32_MAX
 #include <vector>  // vector
-#include <algorithm>  // copy
-#include <random>  // uniform_int_distribution
+#include <algorithm>  // min, max, sort, ...
+#include <memory>  // make_shared, shared_ptr
+#include <utility>  // move
+#include <random>  // mt19937, uniform_int_distribution
 #include <string>  // string
+#include <functional>  // function
+#include <type_traits>  // is_signed, make_unsigned
+#include <unordered_map>  // unordered_map
 
 
+#if !defined(NUMMIXER_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>  // __m256i, _mm256_*
+#define NUMMIXER_AVX2
+#elif !defined(NUMMIXER_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>  // __m128i, _mm_*
+#define NUMMIXER_SSE2
+#endif
+
+
+#include "../include/aliasTable.h"
+#include "../include/boundedRand.h"
+#include "../include/dynamicRankSelect.h"
+#include "../include/mappedFile.h"
+#include "../include/numDataset.h"
 #include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+#include "../include/workerPool.h"
+
+
+static std::size_t boundWords(const std::uint32_t* words, std::size_t count,
+                              std::uint32_t range, std::uint32_t threshold,
+                              std::uint32_t* indexes);
+
+template <class T>
+static std::uint64_t residueOf(T value, std::uint64_t modulus);
+
+template <class T, class Index>
+static void gather(const T* partition, const Index* indexes,
+                   std::size_t count, bool prefetch, T* values);
+
+template <class T, class Index>
+static void computeTerms(std::uint64_t first, std::uint64_t step,
+                         const Index* indexes, std::size_t count, T* values);
+
+
+static const char* const BUILT_IN_NAMES[] = {
+	"MIX", "EVEN", "ODD", "WEIGHTED", "RANGE"
+};
+// The names of the built-in controllers, indexed by OutputController.
+
+
+template <class T, class Engine>
+const std::size_t basicNumMixer<T, Engine>::generator::_BLOCK_SIZE;
 
 
-numMixer::numMixer():
-	_evenValid(true),
-	_oddValid(true),
+template <class T, class Engine>
+basicNumMixer<T, Engine>::generator::generator():
+	_mixer(nullptr),
+	_undrawn(0),
+	_next(0),
+	_filled(0)
+{
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::generator::refill()
+{
+	if (_next == _filled && _undrawn > 0) {
+		_filled = std::min(_BLOCK_SIZE, _undrawn);
+		_next = 0;
+		_undrawn -= _filled;
+		_mixer->genRandNums(_block, _filled);
+	}
+}
+
+
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer():
 	_stateChangeCount(0),
 	_countDown(0),
-	_dataset(0),
+	_dataset(),
+	_datasetPrivate(false),
 	_eng(),
-	_controllerState(MIX)
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
 {
-	// generate valid dataset
+	// valid dataset of 1-100, computed rather than stored and shared by every
+	// default numMixer
 	const int SIZE = 100;
-	_dataset.resize(SIZE);
-	for (int i = 0; i < SIZE; ++i) {
-		_dataset[i] = i + 1;
-	}
+	static const basicNumDatasetHandle<T> DEFAULT_DATASET =
+		std::make_shared<const basicNumDataset<T> >(
+			basicNumDataset<T>::arithmetic(1, SIZE));
+	_dataset = DEFAULT_DATASET;
+	initialize();
+}
 
-	// seed rng
-	int seed = time(0);
-	_eng.seed(seed);
 
-	// calc max ping count
-	const int LOWER_BOUND = 10;
-	const int UPPER_BOUND = 20;
-	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
-	_countDown = distr(_eng);
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer(std::vector<T>& dataset):
+	_stateChangeCount(0),
+	_countDown(0),
+	_dataset(std::make_shared<basicNumDataset<T> >(dataset)),
+	_datasetPrivate(true),
+	_eng(),
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
+{
+	initialize();
+}
+
+
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer(std::vector<T>&& dataset):
+	_stateChangeCount(0),
+	_countDown(0),
+	_dataset(std::make_shared<basicNumDataset<T> >(std::move(dataset))),
+	_datasetPrivate(true),
+	_eng(),
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
+{
+	initialize();
 }
 
 
-numMixer::numMixer(std::vector<int>& dataset):
-	_evenValid(false),
-	_oddValid(false),
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer(const T* data,
+                                        std::size_t size):
 	_stateChangeCount(0),
 	_countDown(0),
-	_dataset(0),
+	_dataset(std::make_shared<basicNumDataset<T> >(data, size)),
+	_datasetPrivate(true),
 	_eng(),
-	_controllerState(MIX)
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
 {
-	// copy dataset
-	_dataset.resize(dataset.size());
-	std::copy(dataset.begin(), dataset.end(), _dataset.begin());
+	initialize();
+}
 
-	// validate dataset
-	for (auto& val : _dataset) {
-		if (val % 2) {
-			_oddValid = true;
-		} else {
-			_evenValid = true;
+
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer(const std::string& path,
+                                        int mapFlags):
+	_stateChangeCount(0),
+	_countDown(0),
+	_dataset(std::make_shared<basicNumDataset<T> >(path, mapFlags)),
+	_datasetPrivate(true),
+	_eng(),
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
+{
+	initialize();
+}
+
+
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer(const std::vector<T>& values,
+                                        const std::vector<double>& weights):
+	_stateChangeCount(0),
+	_countDown(0),
+	_dataset(),
+	_datasetPrivate(true),
+	_eng(),
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
+{
+	std::vector<T> stored(values);
+	if (weights.empty()) {
+		// weights from duplicate counts: keep each distinct value once
+		std::sort(stored.begin(), stored.end());
+		std::vector<double> counts;
+		std::size_t kept = 0;
+		for (std::size_t i = 0; i < stored.size(); ++i) {
+			if (kept > 0 && stored[kept - 1] == stored[i]) {
+				++counts.back();
+			} else {
+				stored[kept++] = stored[i];
+				counts.push_back(1);
+			}
 		}
+		stored.resize(kept);
+		stored.shrink_to_fit();
+		_weights = aliasTable(counts);
+	} else if (weights.size() == values.size()) {
+		_weights = aliasTable(weights);
 	}
+	_dataset = std::make_shared<basicNumDataset<T> >(
+		basicNumDataset<T>::ordered(std::move(stored)));
+	initialize();
+}
 
-	// seed rng
-	int seed = time(0);
-	_eng.seed(seed);
-	
-	// calc max ping count
-	const int LOWER_BOUND = 10;
-	const int UPPER_BOUND = 20;
-	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
-	_countDown = distr(_eng);
+
+template <class T, class Engine>
+basicNumMixer<T, Engine>::basicNumMixer(
+	basicNumDatasetHandle<T> dataset):
+	_stateChangeCount(0),
+	_countDown(0),
+	_dataset(dataset ? dataset : std::make_shared<basicNumDataset<T> >()),
+	_datasetPrivate(!dataset),
+	_eng(),
+	_controllerState(MIX),
+	_weights(),
+	_controllers(),
+	_rangeIndexed(false),
+	_rangeSet(false),
+	_rangeLow(),
+	_rangeHigh(),
+	_rangeBegin(0),
+	_rangeEnd(0)
+{
+	initialize();
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::ping(std::vector<T>& returnValues)
+{
+	if (isActive() && checkStateValid()) {
+		genRandNums(returnValues.data(), returnValues.size());
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::ping(T* values, std::size_t count)
+{
+	if (isActive() && checkStateValid()) {
+		genRandNums(values, count);
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::ping(
+	std::size_t count, const std::function<void(const T*, std::size_t)>& sink)
+{
+	if (isActive() && checkStateValid()) {
+		const std::size_t BLOCK_SIZE = 256;
+		T block[BLOCK_SIZE];
+		for (std::size_t done = 0; done < count; ) {
+			const std::size_t drawn = std::min(BLOCK_SIZE, count - done);
+			genRandNums(block, drawn);
+			sink(block, drawn);
+			done += drawn;
+		}
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
 }
 
 
-bool numMixer::ping(std::vector<int>& returnValues)
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::ping(std::size_t count, generator& values)
 {
 	if (isActive() && checkStateValid()) {
-		for (auto& val : returnValues) {
-			val = genRandNum();
+		values._mixer = this;
+		values._undrawn = count;
+		values._next = 0;
+		values._filled = 0;
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::pingUnique(std::vector<T>& returnValues)
+{
+	const std::size_t count = returnValues.size();
+	const std::size_t population = controllerSize();
+	if (isActive() && checkStateValid() && _controllerState != WEIGHTED
+	    && count <= population) {
+		// sparse partial Fisher-Yates: swap position i with a random later
+		// position, remembering only the positions whose element moved
+		std::unordered_map<std::size_t, std::size_t> moved;
+		moved.reserve(count);
+		for (std::size_t i = 0; i < count; ++i) {
+			const std::size_t r = i + boundedRand(_eng, population - i);
+			const auto atR = moved.find(r);
+			const std::size_t picked = (atR != moved.end()) ? atR->second : r;
+			const auto atI = moved.find(i);
+			moved[r] = (atI != moved.end()) ? atI->second : i;
+			returnValues[i] = controllerValue(picked);
 		}
 		--_countDown;
 		return true;
@@ -91,7 +356,37 @@ bool numMixer::ping(std::vector<int>& returnValues)
 }
 
 
-std::string numMixer::getControllerStateName() const
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::ping(std::vector<T>& returnValues,
+                                    workerPool& pool)
+{
+	if (isActive() && checkStateValid()) {
+		// one word of the numMixer's generator keys every chunk's stream, so
+		// the values depend on the seed but not on the scheduling
+		const std::uint64_t key = randomWord64(_eng);
+		_weights.build();
+		const std::size_t CHUNK_SIZE = 65536;
+		const std::size_t count = returnValues.size();
+		T* values = returnValues.data();
+		pool.run((count + CHUNK_SIZE - 1) / CHUNK_SIZE,
+		         [&](std::size_t chunk) {
+			splitMix64 streams(key);
+			streams.discard(chunk);
+			wordEngine<Engine> eng(streams());
+			const std::size_t begin = chunk * CHUNK_SIZE;
+			drawValues(eng, values + begin,
+			           std::min(CHUNK_SIZE, count - begin));
+		});
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+
+template <class T, class Engine>
+std::string basicNumMixer<T, Engine>::getControllerStateName() const
 {
 	switch (_controllerState) {
 		case MIX:
@@ -100,13 +395,29 @@ std::string numMixer::getControllerStateName() const
 			return "EVEN";
 		case ODD:
 			return "ODD";
+		case WEIGHTED:
+			return "WEIGHTED";
+		case RANGE:
+			return "RANGE";
 		default:
-			return "UNKNOWN";
+			if (const controller* custom = customController()) {
+				return custom->name;
+			} else {
+				return "UNKNOWN";
+			}
 	}
 }
 
 
-void numMixer::setControllerState(OutputController state)
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::seed(std::uint64_t value)
+{
+	_eng.seed(value);
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::setControllerState(OutputController state)
 {
 	if (getControllerState() != state) {
 		_controllerState = state;
@@ -115,41 +426,712 @@ void numMixer::setControllerState(OutputController state)
 }
 
 
-int numMixer::genRandNum()
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::setControllerState(const std::string& name)
+{
+	for (int i = 0; i < FIRST_CUSTOM; ++i) {
+		if (name == BUILT_IN_NAMES[i]) {
+			setControllerState(static_cast<OutputController>(i));
+			return true;
+		}
+	}
+	for (std::size_t i = 0; i < _controllers.size(); ++i) {
+		if (name == _controllers[i].name) {
+			setControllerState(static_cast<OutputController>(FIRST_CUSTOM + i));
+			return true;
+		}
+	}
+	return false;
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::addResidueController(const std::string& name,
+                                                    std::uint64_t modulus,
+                                                    std::uint64_t residue)
 {
-	int upperBound = _dataset.size() - 1;
-	std::uniform_int_distribution<> distr(0, upperBound);
-	int i = distr(_eng);
+	if (modulus == 0) {
+		return false;
+	}
+	return addController(name, [=](T value) {
+		return residueOf(value, modulus) == residue;
+	});
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::addPredicateController(
+	const std::string& name, const std::function<bool(T)>& predicate)
+{
+	return predicate && addController(name, predicate);
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::buildRangeIndex()
+{
+	_dataset->sortedIndex();
+	_rangeIndexed = true;
+	_rangeSet = false;
+	locateRange();
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::buildRangeIndex(workerPool& pool)
+{
+	_dataset->sortedIndex(pool);
+	_rangeIndexed = true;
+	_rangeSet = false;
+	locateRange();
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::setRange(T low, T high)
+{
+	if (!_rangeIndexed || high < low) {
+		return false;
+	}
+	_rangeSet = true;
+	_rangeLow = low;
+	_rangeHigh = high;
+	locateRange();
+	setControllerState(RANGE);
+	return true;
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::setWeight(std::size_t i, double weight)
+{
+	return _weights.setWeight(i, weight);
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::append(T value)
+{
+	if (_weights.size() > 0) {
+		return false;
+	}
+	basicNumDataset<T>& dataset = mutableDataset();
+	const std::size_t oldEvenCount = dataset.evenCount();
+	const std::size_t oldSize = dataset.size();
+	dataset.append(value);
+	datasetChanged(oldEvenCount, oldSize, oldSize);
+	return true;
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::remove(std::size_t i)
+{
+	if (_weights.size() > 0 || i >= _dataset->size()) {
+		return false;
+	}
+	// copying the dataset stores it partitioned, which can move "i"
+	i = _dataset->partitionedIndex(i);
+	basicNumDataset<T>& dataset = mutableDataset();
+	const std::size_t oldEvenCount = dataset.evenCount();
+	const std::size_t oldSize = dataset.size();
+	dataset.remove(i);
+	datasetChanged(oldEvenCount, oldSize, i);
+	return true;
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::update(std::size_t i, T value)
+{
+	if (_weights.size() > 0 || i >= _dataset->size()) {
+		return false;
+	}
+	i = _dataset->partitionedIndex(i);
+	basicNumDataset<T>& dataset = mutableDataset();
+	const std::size_t oldEvenCount = dataset.evenCount();
+	const std::size_t oldSize = dataset.size();
+	dataset.update(i, value);
+	datasetChanged(oldEvenCount, oldSize, i);
+	return true;
+}
 
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::setDataset(basicNumDatasetHandle<T> dataset)
+{
+	if (_weights.size() > 0) {
+		return false;
+	}
+	_dataset = dataset ? dataset : std::make_shared<basicNumDataset<T> >();
+	_datasetPrivate = !dataset;
+	for (std::size_t i = 0; i < _controllers.size(); ++i) {
+		indexController(_controllers[i]);
+	}
+	if (_rangeIndexed) {
+		// a shared dataset may already have its index, built by another
+		// holder
+		_dataset->sortedIndex();
+		locateRange();
+	}
+	return true;
+}
+
+
+template <class T, class Engine>
+T basicNumMixer<T, Engine>::genRandNum()
+{
+	if (_controllerState == WEIGHTED) {
+		_weights.build();
+		return _dataset->at(_weights.sample(_eng));
+	} else {
+		return controllerValue(boundedRand(_eng, controllerSize()));
+	}
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::genRandNums(T* values, std::size_t count)
+{
+	_weights.build();
+	drawValues(_eng, values, count);
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::drawValues(wordEngine<Engine>& eng, T* values,
+                                          std::size_t count) const
+{
+	const std::size_t size = controllerSize();
+	if (size == 0) {
+		return;
+	} else if (_controllerState == WEIGHTED) {
+		for (std::size_t i = 0; i < count; ++i) {
+			values[i] = _dataset->at(_weights.sample(eng));
+		}
+		return;
+	}
+
+	// partitions far larger than the caches make every draw a dependent
+	// memory access, so whole blocks of indexes are drawn before gathering
+	// and the gather prefetches ahead of itself; bench/prefetchBench shows
+	// prefetching costs a little up to 1 MiB, is neutral from 4 to 16 MiB
+	// and pays from 64 MiB on, so it starts at twice a typical L2
+	const std::size_t PREFETCH_BYTES = 1 << 22;
+	const T* partition = controllerPartition();
+	const bool prefetch = (size * sizeof(T) > PREFETCH_BYTES);
+
+	// computed values need neither a load nor a call per value
+	std::uint64_t first = 0;
+	std::uint64_t step = 0;
+	const bool computed = !partition && controllerProgression(first, step);
+
+	const std::size_t BLOCK_SIZE = 256;
+	if (size > UINT32_MAX) {
+		std::uint64_t wideIndexes[BLOCK_SIZE];
+		for (std::size_t done = 0; done < count; ) {
+			const std::size_t drawn = std::min(BLOCK_SIZE, count - done);
+			for (std::size_t i = 0; i < drawn; ++i) {
+				wideIndexes[i] = boundedRand(eng, size);
+			}
+			if (partition) {
+				gather(partition, wideIndexes, drawn, prefetch, values + done);
+			} else if (computed) {
+				computeTerms(first, step, wideIndexes, drawn, values + done);
+			} else {
+				for (std::size_t i = 0; i < drawn; ++i) {
+					values[done + i] = controllerValue(wideIndexes[i]);
+				}
+			}
+			done += drawn;
+		}
+		return;
+	}
+
+	// one division per ping instead of one distribution per value
+	const std::uint32_t range = size;
+	const std::uint32_t threshold = boundedThreshold(range);
+
+	std::uint32_t words[BLOCK_SIZE];
+	std::uint32_t indexes[BLOCK_SIZE];
+	std::size_t done = 0;
+	while (done < count) {
+		// only draw as many words as are still needed, so the generator
+		// advances exactly as it would for single draws
+		std::size_t needed = std::min(BLOCK_SIZE, count - done);
+		for (std::size_t i = 0; i < needed; ++i) {
+			words[i] = eng();
+		}
+		std::size_t produced = boundWords(words, needed, range, threshold,
+		                                  indexes);
+		if (partition) {
+			gather(partition, indexes, produced, prefetch, values + done);
+		} else if (computed) {
+			computeTerms(first, step, indexes, produced, values + done);
+		} else {
+			for (std::size_t i = 0; i < produced; ++i) {
+				values[done + i] = controllerValue(indexes[i]);
+			}
+		}
+		done += produced;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::checkStateValid() const
+{
 	switch (_controllerState) {
 		case MIX:
-			return _dataset[i];
+			return !_dataset->empty();
 		case EVEN:
-			while (_dataset[i] % 2 != 0) {
-				i = distr(_eng);
-			}
-			return _dataset[i];
+			return (_dataset->evenCount() > 0);
 		case ODD:
-			while (_dataset[i] % 2 != 1) {
-				i = distr(_eng);
+			return (_dataset->oddCount() > 0);
+		case WEIGHTED:
+			return !_weights.empty();
+		case RANGE:
+			return _rangeEnd > _rangeBegin;
+		default:
+			if (const controller* custom = customController()) {
+				return custom->ones() > 0;
+			} else {
+				return false;
 			}
-			return _dataset[i];
+	}
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::initialize()
+{
+	// seed rng
+	_eng.seed(time(0));
+
+	// calc max ping count
+	const int LOWER_BOUND = 10;
+	const int UPPER_BOUND = 20;
+	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
+	_countDown = distr(_eng);
+}
+
+
+template <class T, class Engine>
+basicNumDataset<T>& basicNumMixer<T, Engine>::mutableDataset()
+{
+	// copy on write: never touch a dataset another holder can see, or values
+	// the numMixer does not own
+	if (!_datasetPrivate || _dataset.use_count() > 1
+	    || !_dataset->contiguous()) {
+		const bool renumbered = !_dataset->contiguous();
+		std::shared_ptr<basicNumDataset<T> > copy =
+			std::make_shared<basicNumDataset<T> >(
+				_dataset->toPartitionedVector(), _dataset->profile());
+		copy->copySortedIndex(*_dataset);
+		_dataset = copy;
+		_datasetPrivate = true;
+		if (renumbered) {
+			for (std::size_t i = 0; i < _controllers.size(); ++i) {
+				indexController(_controllers[i]);
+			}
+		}
+	}
+	return const_cast<basicNumDataset<T>&>(*_dataset);
+}
+
+
+template <class T, class Engine>
+std::size_t basicNumMixer<T, Engine>::controllerSize() const
+{
+	switch (_controllerState) {
+		case EVEN:
+			return _dataset->evenCount();
+		case ODD:
+			return _dataset->oddCount();
+		case MIX:
+		case WEIGHTED:
+			return _dataset->size();
+		case RANGE:
+			return _rangeEnd - _rangeBegin;
 		default:
-			return 0;
+			if (const controller* custom = customController()) {
+				return custom->ones();
+			} else {
+				return 0;
+			}
 	}
 }
 
 
-bool numMixer::checkStateValid() const
+template <class T, class Engine>
+const T* basicNumMixer<T, Engine>::controllerPartition() const
+{
+	if (_controllerState == RANGE) {
+		return _dataset->sortedIndex().run(_rangeBegin, _rangeEnd);
+	} else if (_dataset->isArithmetic()) {
+		return nullptr;
+	} else if (_controllerState == MIX) {
+		return _dataset->data();
+	} else if (!_dataset->contiguous()) {
+		return nullptr;
+	} else if (_controllerState == EVEN) {
+		return _dataset->data();
+	} else if (_controllerState == ODD) {
+		return _dataset->data() + _dataset->evenCount();
+	} else {
+		return nullptr;
+	}
+}
+
+
+template <class T, class Engine>
+T basicNumMixer<T, Engine>::controllerValue(std::size_t j) const
 {
 	switch (_controllerState) {
+		case EVEN:
+			return _dataset->evenAt(j);
+		case ODD:
+			return _dataset->oddAt(j);
 		case MIX:
-			return true;
+		case WEIGHTED:
+			return _dataset->at(j);
+		case RANGE:
+			return _dataset->sortedIndex().at(_rangeBegin + j);
+		default:
+			return _dataset->at(customController()->select1(j));
+	}
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::controllerProgression(std::uint64_t& first,
+                                                     std::uint64_t& step) const
+{
+	if (!_dataset->isArithmetic()) {
+		return false;
+	}
+	switch (_controllerState) {
 		case EVEN:
-			return _evenValid;
+			_dataset->evenProgression(first, step);
+			return true;
 		case ODD:
-			return _oddValid;
+			_dataset->oddProgression(first, step);
+			return true;
+		case MIX:
+			_dataset->progression(first, step);
+			return true;
 		default:
 			return false;
 	}
-}
\ No newline at end of file
+}
+
+
+template <class T, class Engine>
+bool basicNumMixer<T, Engine>::addController(
+	const std::string& name, const std::function<bool(T)>& predicate)
+{
+	if (name.empty()) {
+		return false;
+	}
+	for (int i = 0; i < FIRST_CUSTOM; ++i) {
+		if (name == BUILT_IN_NAMES[i]) {
+			return false;
+		}
+	}
+	for (std::size_t i = 0; i < _controllers.size(); ++i) {
+		if (name == _controllers[i].name) {
+			return false;
+		}
+	}
+
+	controller custom;
+	custom.name = name;
+	custom.predicate = predicate;
+	indexController(custom);
+	_controllers.push_back(std::move(custom));
+	return true;
+}
+
+
+template <class T, class Engine>
+const typename basicNumMixer<T, Engine>::controller*
+basicNumMixer<T, Engine>::customController() const
+{
+	const std::size_t index = _controllerState - FIRST_CUSTOM;
+	if (_controllerState >= FIRST_CUSTOM && index < _controllers.size()) {
+		return &_controllers[index];
+	} else {
+		return nullptr;
+	}
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::indexController(controller& custom)
+{
+	// compile the predicate into a bitmap over the dataset positions, a
+	// word at a time, and count it once
+	const std::size_t size = _dataset->size();
+	custom.members = rankSelect(size);
+	custom.patched = dynamicRankSelect();
+	custom.mutated = false;
+	for (std::size_t w = 0; w * 64 < size; ++w) {
+		std::uint64_t bits = 0;
+		const std::size_t end = std::min(size, w * 64 + 64);
+		for (std::size_t i = w * 64; i < end; ++i) {
+			bits |= static_cast<std::uint64_t>(
+				custom.predicate(_dataset->at(i))) << (i & 63);
+		}
+		custom.members.setWord(w, bits);
+	}
+	custom.members.build();
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::datasetChanged(std::size_t oldEvenCount,
+                                              std::size_t oldSize,
+                                              std::size_t i)
+{
+	// a mutation only moves values between these positions
+	const std::size_t size = _dataset->size();
+	const std::size_t evenCount = _dataset->evenCount();
+	const std::size_t touched[] = {
+		i, oldEvenCount - 1, oldEvenCount, evenCount - 1, evenCount,
+		oldSize - 1, size - 1
+	};
+	for (std::size_t c = 0; c < _controllers.size(); ++c) {
+		controller& custom = _controllers[c];
+		if (!custom.mutated) {
+			// first mutation: trade the static select for Fenwick counts
+			// that can be patched
+			custom.patched = dynamicRankSelect(custom.members.size());
+			for (std::size_t w = 0; w * 64 < custom.members.size(); ++w) {
+				custom.patched.setWord(w, custom.members.word(w));
+			}
+			custom.patched.build();
+			custom.members = rankSelect();
+			custom.mutated = true;
+		}
+		custom.patched.resize(size);
+		for (std::size_t t = 0; t < sizeof(touched) / sizeof(*touched); ++t) {
+			const std::size_t pos = touched[t];
+			if (pos >= size) {
+				continue;
+			} else if (custom.predicate(_dataset->at(pos))) {
+				custom.patched.set(pos);
+			} else {
+				custom.patched.reset(pos);
+			}
+		}
+	}
+
+	locateRange();
+}
+
+
+template <class T, class Engine>
+void basicNumMixer<T, Engine>::locateRange()
+{
+	if (_rangeSet) {
+		const basicSortedIndex<T>& sorted = _dataset->sortedIndex();
+		_rangeBegin = sorted.lowerBound(_rangeLow);
+		_rangeEnd = sorted.upperBound(_rangeHigh);
+	} else {
+		_rangeBegin = 0;
+		_rangeEnd = 0;
+	}
+}
+
+
+// supported element types and engines
+template class basicNumMixer<std::int8_t, std::mt19937>;
+template class basicNumMixer<std::int8_t, xoshiro256ss>;
+template class basicNumMixer<std::int8_t, pcg64>;
+template class basicNumMixer<std::int8_t, splitMix64>;
+template class basicNumMixer<std::uint8_t, std::mt19937>;
+template class basicNumMixer<std::uint8_t, xoshiro256ss>;
+template class basicNumMixer<std::uint8_t, pcg64>;
+template class basicNumMixer<std::uint8_t, splitMix64>;
+template class basicNumMixer<std::int16_t, std::mt19937>;
+template class basicNumMixer<std::int16_t, xoshiro256ss>;
+template class basicNumMixer<std::int16_t, pcg64>;
+template class basicNumMixer<std::int16_t, splitMix64>;
+template class basicNumMixer<std::uint16_t, std::mt19937>;
+template class basicNumMixer<std::uint16_t, xoshiro256ss>;
+template class basicNumMixer<std::uint16_t, pcg64>;
+template class basicNumMixer<std::uint16_t, splitMix64>;
+template class basicNumMixer<int, std::mt19937>;
+template class basicNumMixer<int, xoshiro256ss>;
+template class basicNumMixer<int, pcg64>;
+template class basicNumMixer<int, splitMix64>;
+template class basicNumMixer<std::uint32_t, std::mt19937>;
+template class basicNumMixer<std::uint32_t, xoshiro256ss>;
+template class basicNumMixer<std::uint32_t, pcg64>;
+template class basicNumMixer<std::uint32_t, splitMix64>;
+template class basicNumMixer<std::int64_t, std::mt19937>;
+template class basicNumMixer<std::int64_t, xoshiro256ss>;
+template class basicNumMixer<std::int64_t, pcg64>;
+template class basicNumMixer<std::int64_t, splitMix64>;
+template class basicNumMixer<std::uint64_t, std::mt19937>;
+template class basicNumMixer<std::uint64_t, xoshiro256ss>;
+template class basicNumMixer<std::uint64_t, pcg64>;
+template class basicNumMixer<std::uint64_t, splitMix64>;
+
+
+static std::size_t boundWords(const std::uint32_t* words, std::size_t count,
+                              std::uint32_t range, std::uint32_t threshold,
+                              std::uint32_t* indexes)
+{
+	std::size_t produced = 0;
+	std::size_t i = 0;
+
+#if defined(NUMMIXER_AVX2)
+	const __m256i rangeVec = _mm256_set1_epi32(range);
+	const __m256i signBit = _mm256_set1_epi32(0x80000000);
+	const __m256i thresholdVec = _mm256_xor_si256(
+		_mm256_set1_epi32(threshold), signBit);
+	const __m256i highMask = _mm256_set1_epi64x(0xFFFFFFFF00000000LL);
+	for (; i + 8 <= count; i += 8) {
+		__m256i x = _mm256_loadu_si256(
+			reinterpret_cast<const __m256i*>(words + i));
+		__m256i evenProd = _mm256_mul_epu32(x, rangeVec);
+		__m256i oddProd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), rangeVec);
+		__m256i high = _mm256_or_si256(_mm256_srli_epi64(evenProd, 32),
+		                               _mm256_and_si256(oddProd, highMask));
+		__m256i low = _mm256_or_si256(_mm256_andnot_si256(highMask, evenProd),
+		                              _mm256_slli_epi64(oddProd, 32));
+		__m256i reject = _mm256_cmpgt_epi32(thresholdVec,
+		                                    _mm256_xor_si256(low, signBit));
+		if (_mm256_testz_si256(reject, reject)) {
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(indexes + produced),
+			                    high);
+			produced += 8;
+		} else {
+			for (std::size_t j = i; j < i + 8; ++j) {
+				std::uint64_t product = static_cast<std::uint64_t>(words[j])
+				                        * range;
+				if (static_cast<std::uint32_t>(product) >= threshold) {
+					indexes[produced++] = product >> 32;
+				}
+			}
+		}
+	}
+#elif defined(NUMMIXER_SSE2)
+	const __m128i rangeVec = _mm_set1_epi32(range);
+	const __m128i signBit = _mm_set1_epi32(0x80000000);
+	const __m128i thresholdVec = _mm_xor_si128(_mm_set1_epi32(threshold),
+	                                           signBit);
+	const __m128i highMask = _mm_set_epi32(-1, 0, -1, 0);
+	for (; i + 4 <= count; i += 4) {
+		__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+		__m128i evenProd = _mm_mul_epu32(x, rangeVec);
+		__m128i oddProd = _mm_mul_epu32(_mm_srli_epi64(x, 32), rangeVec);
+		__m128i high = _mm_or_si128(_mm_srli_epi64(evenProd, 32),
+		                            _mm_and_si128(oddProd, highMask));
+		__m128i low = _mm_or_si128(_mm_andnot_si128(highMask, evenProd),
+		                           _mm_slli_epi64(oddProd, 32));
+		__m128i reject = _mm_cmplt_epi32(_mm_xor_si128(low, signBit),
+		                                 thresholdVec);
+		if (_mm_movemask_epi8(reject) == 0) {
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(indexes + produced),
+			                 high);
+			produced += 4;
+		} else {
+			for (std::size_t j = i; j < i + 4; ++j) {
+				std::uint64_t product = static_cast<std::uint64_t>(words[j])
+				                        * range;
+				if (static_cast<std::uint32_t>(product) >= threshold) {
+					indexes[produced++] = product >> 32;
+				}
+			}
+		}
+	}
+#endif
+
+	for (; i < count; ++i) {
+		std::uint64_t product = static_cast<std::uint64_t>(words[i]) * range;
+		if (static_cast<std::uint32_t>(product) >= threshold) {
+			indexes[produced++] = product >> 32;
+		}
+	}
+	return produced;
+}
+// DESCRIPTION:
+// * Maps each random word onto [0, "range") with a multiply-shift, storing
+// the accepted indexes into "indexes" and returning how many were accepted.
+// * Words whose low product half falls below "threshold" are rejected, which
+// keeps the mapping unbiased and matches boundedRand32() draw for draw.
+// * Lanes are processed 8 (AVX2) or 4 (SSE2) at a time; a block containing a
+// rejection falls back to the scalar loop.
+//
+// PRECONDITIONS:
+// * "threshold" must equal (2^32 - "range") % "range".
+// * "indexes" must hold at least "count" values.
+
+
+template <class T>
+static std::uint64_t residueOf(T value, std::uint64_t modulus)
+{
+	typedef typename std::make_unsigned<T>::type unsignedType;
+	if (std::is_signed<T>::value && value < T(0)) {
+		// residue of the magnitude, reflected into [0, modulus)
+		const std::uint64_t magnitude = static_cast<unsignedType>(
+			unsignedType(0) - static_cast<unsignedType>(value));
+		const std::uint64_t residue = magnitude % modulus;
+		return (residue == 0) ? 0 : modulus - residue;
+	} else {
+		return static_cast<std::uint64_t>(value) % modulus;
+	}
+}
+// DESCRIPTION:
+// * Returns the non-negative residue of "value" modulo "modulus".
+//
+// PRECONDITIONS:
+// * "modulus" must be greater than 0.
+
+
+template <class T, class Index>
+static void gather(const T* partition, const Index* indexes,
+                   std::size_t count, bool prefetch, T* values)
+{
+	// about one memory latency (~100 ns) of gathered values: 32 beat 16 at
+	// 256 MiB and 1 GiB, and tied at 64 MiB (see bench/prefetchBench)
+	const std::size_t DISTANCE = 32;
+	if (!prefetch || count <= DISTANCE) {
+		for (std::size_t i = 0; i < count; ++i) {
+			values[i] = partition[indexes[i]];
+		}
+		return;
+	}
+
+	// keep DISTANCE loads in flight ahead of the one being consumed
+	for (std::size_t i = 0; i < DISTANCE; ++i) {
+		__builtin_prefetch(partition + indexes[i]);
+	}
+	for (std::size_t i = 0; i < count - DISTANCE; ++i) {
+		__builtin_prefetch(partition + indexes[i + DISTANCE]);
+		values[i] = partition[indexes[i]];
+	}
+	for (std::size_t i = count - DISTANCE; i < count; ++i) {
+		values[i] = partition[indexes[i]];
+	}
+}
+// DESCRIPTION:
+// * Stores partition["indexes"[i]] into "values"[i] for every i below
+// "count", prefetching a fixed distance ahead if "prefetch" is set. The
+// values are the same either way.
+
+
+template <class T, class Index>
+static void computeTerms(std::uint64_t first, std::uint64_t step,
+                         const Index* indexes, std::size_t count, T* values)
+{
+	for (std::size_t i = 0; i < count; ++i) {
+		values[i] = static_cast<T>(first + indexes[i] * step);
+	}
+}
+// DESCRIPTION:
+// * Stores term "indexes"[i] of the progression "first", "first" + "step",
+// ... into "values"[i] for every i below "count". Only the indexes are
+// loaded, and the loop vectorizes.
\ No newline at end of file
@@ -12,10 +12,13 @@
 // * Otherwise, functions are implemented as defined in their parents.
 
 
+#include <cstddef>  // size_t
 #include <vector>  // vector
 #include <string>  // string
+#include <utility>  // move
 
 
+#include "../include/numDataset.h"
 #include "../include/numMixer.h"
 #include "../include/numMixerTmVolatileSeer.h"
 #include "../include/tmVolatileSeer.h"
@@ -42,13 +45,44 @@ numMixerTmVolatileSeer::numMixerTmVolatileSeer(int q,
 }
 
 
+numMixerTmVolatileSeer::numMixerTmVolatileSeer(int q,
+                                               std::vector<int>&& dataset):
+	seer(q),
+	numMixer(std::move(dataset)),
+	tmVolatileSeer(q),
+	_stateChangeCount(0)
+{
+	_name = "numMixerTmVolatileSeer";
+}
+
+
+numMixerTmVolatileSeer::numMixerTmVolatileSeer(int q, const int* data,
+                                               std::size_t size):
+	seer(q),
+	numMixer(data, size),
+	tmVolatileSeer(q),
+	_stateChangeCount(0)
+{
+	_name = "numMixerTmVolatileSeer";
+}
+
+
+numMixerTmVolatileSeer::numMixerTmVolatileSeer(int q,
+                                               numDatasetHandle dataset):
+	seer(q),
+	numMixer(dataset),
+	tmVolatileSeer(q),
+	_stateChangeCount(0)
+{
+	_name = "numMixerTmVolatileSeer";
+}
+
+
 bool numMixerTmVolatileSeer::ping(std::vector<int>& returnValues)
 {
 	// numMxier's implementation
 	if (isActive() && numMixer::checkStateValid()) {
-		for (auto& val : returnValues) {
-			val = numMixer::genRandNum();
-		}
+		numMixer::genRandNums(returnValues.data(), returnValues.size());
 		--_countDown;
 		return true;
 	} else {
@@ -78,7 +112,7 @@ void numMixerTmVolatileSeer::request(std::string& fetchedMessage)
 		// numMixer's countdown
 		--_countDown;
 	}
-	if (volatileSeer::genRandNum() < _REJECT_CHANCE) {
+	if (volatileSeer::rejectRequest()) {
 		fetchedMessage.clear();
 	}
 }
@@ -0,0 +1,364 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: prefillNumMixer.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * 0 <= head - tail <= _mask + 1 for every ring. Only the producer advances
+// head and only the pinging thread advances tail, each after it has finished
+// writing or reading the values in between.
+// * The producer only runs between start() and stop(), and only it touches
+// the ring samplers meanwhile.
+
+
+#include <ctime>  // time
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <cstring>  // memcpy
+#include <algorithm>  // min
+#include <atomic>  // atomic
+#include <condition_variable>  // condition_variable
+#include <memory>  // make_shared, unique_ptr
+#include <mutex>  // mutex, unique_lock
+#include <random>  // mt19937, uniform_int_distribution
+#include <thread>  // thread
+#include <vector>  // vector
+
+
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+#include "../include/prefillNumMixer.h"
+#include "../include/rngEngines.h"
+
+
+template <class T, class Engine>
+basicPrefillNumMixer<T, Engine>::basicPrefillNumMixer(std::size_t bufferSize):
+	_dataset(),
+	_mask(0),
+	_rings(),
+	_direct(basicNumDatasetHandle<T>()),
+	_producer(),
+	_stopping(false),
+	_sleeping(false),
+	_wakeLock(),
+	_wake(),
+	_stateChangeCount(0),
+	_countDown(0),
+	_controllerState(MIX)
+{
+	// valid dataset of 1-100, shared by every default prefillNumMixer
+	const int SIZE = 100;
+	static const basicNumDatasetHandle<T> DEFAULT_DATASET =
+		std::make_shared<const basicNumDataset<T> >(
+			basicNumDataset<T>::arithmetic(1, SIZE));
+	_dataset = DEFAULT_DATASET;
+	initialize(bufferSize, time(0));
+}
+
+
+template <class T, class Engine>
+basicPrefillNumMixer<T, Engine>::basicPrefillNumMixer(
+	basicNumDatasetHandle<T> dataset, std::size_t bufferSize):
+	_dataset(dataset ? dataset
+	                 : std::make_shared<const basicNumDataset<T> >()),
+	_mask(0),
+	_rings(),
+	_direct(basicNumDatasetHandle<T>()),
+	_producer(),
+	_stopping(false),
+	_sleeping(false),
+	_wakeLock(),
+	_wake(),
+	_stateChangeCount(0),
+	_countDown(0),
+	_controllerState(MIX)
+{
+	initialize(bufferSize, time(0));
+}
+
+
+template <class T, class Engine>
+basicPrefillNumMixer<T, Engine>::~basicPrefillNumMixer()
+{
+	stop();
+}
+
+
+template <class T, class Engine>
+bool basicPrefillNumMixer<T, Engine>::ping(std::vector<T>& returnValues)
+{
+	return ping(returnValues.data(), returnValues.size());
+}
+
+
+template <class T, class Engine>
+bool basicPrefillNumMixer<T, Engine>::ping(T* values, std::size_t count)
+{
+	if (!isActive() || !checkStateValid(_controllerState)) {
+		return false;
+	}
+
+	ring& buffer = _rings[_controllerState];
+	const std::size_t size = _mask + 1;
+	const std::size_t tail = buffer.tail.load(std::memory_order_relaxed);
+	const std::size_t head = buffer.head.load(std::memory_order_acquire);
+	if (head - tail >= count) {
+		// at most two runs: up to the end of the ring, then from its start
+		const std::size_t begin = tail & _mask;
+		const std::size_t first = std::min(count, size - begin);
+		std::memcpy(values, buffer.values.get() + begin, first * sizeof(T));
+		std::memcpy(values + first, buffer.values.get(),
+		            (count - first) * sizeof(T));
+		buffer.tail.store(tail + count, std::memory_order_release);
+		if (head - (tail + count) <= size / 2) {
+			wakeProducer();
+		}
+	} else {
+		_direct.setControllerState(_controllerState);
+		_direct.genRandNums(values, count);
+		buffer.underruns.fetch_add(1, std::memory_order_relaxed);
+		wakeProducer();
+	}
+	--_countDown;
+	return true;
+}
+
+
+template <class T, class Engine>
+std::size_t basicPrefillNumMixer<T, Engine>::buffered(
+	OutputController state) const
+{
+	if (state != MIX && state != EVEN && state != ODD) {
+		return 0;
+	}
+	const ring& buffer = _rings[state];
+	return buffer.head.load() - buffer.tail.load();
+}
+
+
+template <class T, class Engine>
+std::uint64_t basicPrefillNumMixer<T, Engine>::underrunCount() const
+{
+	return underrunCount(MIX) + underrunCount(EVEN) + underrunCount(ODD);
+}
+
+
+template <class T, class Engine>
+std::uint64_t basicPrefillNumMixer<T, Engine>::underrunCount(
+	OutputController state) const
+{
+	if (state != MIX && state != EVEN && state != ODD) {
+		return 0;
+	}
+	return _rings[state].underruns.load();
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::seed(std::uint64_t value)
+{
+	stop();
+	rekey(value);
+	start();
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::setControllerState(
+	OutputController state)
+{
+	if (getControllerState() != state) {
+		_controllerState = state;
+		++_stateChangeCount;
+	}
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::initialize(std::size_t bufferSize,
+                                                 std::uint64_t key)
+{
+	// round up to a power of two so positions wrap with a mask
+	std::size_t size = 1;
+	while (size < bufferSize) {
+		size <<= 1;
+	}
+	_mask = size - 1;
+
+	_direct.setDataset(_dataset);
+	_rings.reset(new ring[3]);
+	for (int c = 0; c < 3; ++c) {
+		ring& buffer = _rings[c];
+		buffer.values.reset(new T[size]);
+		buffer.underruns = 0;
+		buffer.sampler.setDataset(_dataset);
+		buffer.sampler.setControllerState(static_cast<OutputController>(c));
+	}
+	rekey(key);
+
+	// calc max ping count
+	const int LOWER_BOUND = 10;
+	const int UPPER_BOUND = 20;
+	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
+	wordEngine<Engine> eng(key);
+	_countDown = distr(eng);
+
+	start();
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::rekey(std::uint64_t key)
+{
+	splitMix64 streams(key);
+	_direct.seed(streams());
+	for (int c = 0; c < 3; ++c) {
+		_rings[c].head = 0;
+		_rings[c].tail = 0;
+		_rings[c].sampler.seed(streams());
+	}
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::start()
+{
+	_stopping = false;
+	_producer = std::thread(&basicPrefillNumMixer::produce, this);
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(_wakeLock);
+		_stopping = true;
+	}
+	_wake.notify_one();
+	if (_producer.joinable()) {
+		_producer.join();
+	}
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::produce()
+{
+	while (!_stopping) {
+		bool refilled = false;
+		for (int c = 0; c < 3; ++c) {
+			if (checkStateValid(static_cast<OutputController>(c))) {
+				refilled = refill(_rings[c]) || refilled;
+			}
+		}
+		if (!refilled) {
+			// announce the sleep before checking the rings: a ping either
+			// sees the announcement or its tail is seen by the check
+			std::unique_lock<std::mutex> lock(_wakeLock);
+			_sleeping = true;
+			_wake.wait(lock, [this] { return _stopping || hungry(); });
+			_sleeping = false;
+		}
+	}
+}
+
+
+template <class T, class Engine>
+void basicPrefillNumMixer<T, Engine>::wakeProducer()
+{
+	// orders the caller's tail store before the load of _sleeping
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_sleeping.load(std::memory_order_relaxed)) {
+		std::lock_guard<std::mutex> lock(_wakeLock);
+		_wake.notify_one();
+	}
+}
+
+
+template <class T, class Engine>
+bool basicPrefillNumMixer<T, Engine>::refill(ring& buffer)
+{
+	const std::size_t size = _mask + 1;
+	const std::size_t head = buffer.head.load(std::memory_order_relaxed);
+	const std::size_t tail = buffer.tail.load(std::memory_order_acquire);
+	const std::size_t free = size - (head - tail);
+	if (free < size / 2 || free == 0) {
+		return false;
+	}
+
+	const std::size_t begin = head & _mask;
+	const std::size_t first = std::min(free, size - begin);
+	buffer.sampler.genRandNums(buffer.values.get() + begin, first);
+	buffer.sampler.genRandNums(buffer.values.get(), free - first);
+	buffer.head.store(head + free, std::memory_order_release);
+	return true;
+}
+
+
+template <class T, class Engine>
+bool basicPrefillNumMixer<T, Engine>::hungry() const
+{
+	const std::size_t size = _mask + 1;
+	for (int c = 0; c < 3; ++c) {
+		const ring& buffer = _rings[c];
+		if (checkStateValid(static_cast<OutputController>(c))
+		    && buffer.head.load() - buffer.tail.load() <= size / 2) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
+template <class T, class Engine>
+bool basicPrefillNumMixer<T, Engine>::checkStateValid(
+	OutputController state) const
+{
+	switch (state) {
+		case MIX:
+			return !_dataset->empty();
+		case EVEN:
+			return (_dataset->evenCount() > 0);
+		case ODD:
+			return (_dataset->oddCount() > 0);
+		default:
+			return false;
+	}
+}
+
+
+// supported element types and engines
+template class basicPrefillNumMixer<std::int8_t, std::mt19937>;
+template class basicPrefillNumMixer<std::int8_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::int8_t, pcg64>;
+template class basicPrefillNumMixer<std::int8_t, splitMix64>;
+template class basicPrefillNumMixer<std::uint8_t, std::mt19937>;
+template class basicPrefillNumMixer<std::uint8_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::uint8_t, pcg64>;
+template class basicPrefillNumMixer<std::uint8_t, splitMix64>;
+template class basicPrefillNumMixer<std::int16_t, std::mt19937>;
+template class basicPrefillNumMixer<std::int16_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::int16_t, pcg64>;
+template class basicPrefillNumMixer<std::int16_t, splitMix64>;
+template class basicPrefillNumMixer<std::uint16_t, std::mt19937>;
+template class basicPrefillNumMixer<std::uint16_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::uint16_t, pcg64>;
+template class basicPrefillNumMixer<std::uint16_t, splitMix64>;
+template class basicPrefillNumMixer<int, std::mt19937>;
+template class basicPrefillNumMixer<int, xoshiro256ss>;
+template class basicPrefillNumMixer<int, pcg64>;
+template class basicPrefillNumMixer<int, splitMix64>;
+template class basicPrefillNumMixer<std::uint32_t, std::mt19937>;
+template class basicPrefillNumMixer<std::uint32_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::uint32_t, pcg64>;
+template class basicPrefillNumMixer<std::uint32_t, splitMix64>;
+template class basicPrefillNumMixer<std::int64_t, std::mt19937>;
+template class basicPrefillNumMixer<std::int64_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::int64_t, pcg64>;
+template class basicPrefillNumMixer<std::int64_t, splitMix64>;
+template class basicPrefillNumMixer<std::uint64_t, std::mt19937>;
+template class basicPrefillNumMixer<std::uint64_t, xoshiro256ss>;
+template class basicPrefillNumMixer<std::uint64_t, pcg64>;
+template class basicPrefillNumMixer<std::uint64_t, splitMix64>;
\ No newline at end of file
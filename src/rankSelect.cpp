@@ -0,0 +1,187 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: rankSelect.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _ranks has one entry per 512-bit block plus a final entry holding the
+// total number of set bits.
+// * Bits past _size in the last word are always unset.
+// * Popcounts and in-word selects use GCC builtins (and BMI2 when the target
+// supports it).
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <vector>  // vector
+#include <algorithm>  // min
+
+
+#if defined(__BMI2__)
+#include <immintrin.h>  // _pdep_u64
+#endif
+
+
+#include "../include/rankSelect.h"
+
+
+rankSelect::rankSelect():
+	_size(0),
+	_words(),
+	_ranks(),
+	_hints1(),
+	_hints0()
+{
+}
+
+
+rankSelect::rankSelect(std::size_t size):
+	_size(size),
+	_words((size + 63) / 64, 0),
+	_ranks(),
+	_hints1(),
+	_hints0()
+{
+}
+
+
+void rankSelect::resize(std::size_t size)
+{
+	_size = size;
+	_words.resize((size + 63) / 64, 0);
+	if (size & 63) {
+		_words.back() &= (1ULL << (size & 63)) - 1;
+	}
+}
+
+
+void rankSelect::build()
+{
+	const std::size_t blocks = (_words.size() + _BLOCK_WORDS - 1)
+	                           / _BLOCK_WORDS;
+	_ranks.assign(blocks + 1, 0);
+	_hints1.clear();
+	_hints0.clear();
+
+	std::uint64_t count = 0;
+	for (std::size_t b = 0; b < blocks; ++b) {
+		_ranks[b] = count;
+		const std::size_t end = std::min(_words.size(), (b + 1) * _BLOCK_WORDS);
+		for (std::size_t w = b * _BLOCK_WORDS; w < end; ++w) {
+			count += __builtin_popcountll(_words[w]);
+		}
+	}
+	_ranks[blocks] = count;
+
+	// record the block holding every _HINT_STEP-th set and unset bit
+	const std::size_t zeroCount = zeros();
+	for (std::size_t b = 0; b < blocks; ++b) {
+		while (_hints1.size() * _HINT_STEP < _ranks[b + 1]) {
+			_hints1.push_back(b);
+		}
+		const std::size_t zerosAfter = std::min(blockZeros(b + 1), zeroCount);
+		while (_hints0.size() * _HINT_STEP < zerosAfter) {
+			_hints0.push_back(b);
+		}
+	}
+}
+
+
+std::size_t rankSelect::rank1(std::size_t pos) const
+{
+	const std::size_t block = pos / (_BLOCK_WORDS * 64);
+	std::size_t rank = _ranks[block];
+	const std::size_t word = pos >> 6;
+	for (std::size_t w = block * _BLOCK_WORDS; w < word; ++w) {
+		rank += __builtin_popcountll(_words[w]);
+	}
+	if (pos & 63) {
+		const std::uint64_t mask = (1ULL << (pos & 63)) - 1;
+		rank += __builtin_popcountll(_words[word] & mask);
+	}
+	return rank;
+}
+
+
+std::size_t rankSelect::select1(std::size_t j) const
+{
+	// binary search the blocks between the surrounding hints
+	const std::size_t hint = j / _HINT_STEP;
+	std::size_t low = _hints1[hint];
+	std::size_t high = (hint + 1 < _hints1.size()) ? _hints1[hint + 1]
+	                                               : _ranks.size() - 2;
+	while (low < high) {
+		std::size_t mid = (low + high + 1) / 2;
+		if (_ranks[mid] <= j) {
+			low = mid;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	// scan the block's words
+	std::size_t remaining = j - _ranks[low];
+	for (std::size_t w = low * _BLOCK_WORDS; ; ++w) {
+		const std::size_t count = __builtin_popcountll(_words[w]);
+		if (remaining < count) {
+			return w * 64 + selectInWord(_words[w], remaining);
+		}
+		remaining -= count;
+	}
+}
+
+
+std::size_t rankSelect::select0(std::size_t j) const
+{
+	// binary search the blocks between the surrounding hints
+	const std::size_t hint = j / _HINT_STEP;
+	std::size_t low = _hints0[hint];
+	std::size_t high = (hint + 1 < _hints0.size()) ? _hints0[hint + 1]
+	                                               : _ranks.size() - 2;
+	while (low < high) {
+		std::size_t mid = (low + high + 1) / 2;
+		if (blockZeros(mid) <= j) {
+			low = mid;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	// scan the block's words
+	std::size_t remaining = j - blockZeros(low);
+	for (std::size_t w = low * _BLOCK_WORDS; ; ++w) {
+		const std::size_t count = __builtin_popcountll(~_words[w]);
+		if (remaining < count) {
+			return w * 64 + selectInWord(~_words[w], remaining);
+		}
+		remaining -= count;
+	}
+}
+
+
+unsigned rankSelect::selectInWord(std::uint64_t word, unsigned j)
+{
+#if defined(__BMI2__)
+	return __builtin_ctzll(_pdep_u64(1ULL << j, word));
+#else
+	while (j--) {
+		word &= word - 1;
+	}
+	return __builtin_ctzll(word);
+#endif
+}
+
+
+std::size_t rankSelect::memoryUsage() const
+{
+	return _words.size() * sizeof(std::uint64_t)
+	       + _ranks.size() * sizeof(std::uint64_t)
+	       + (_hints1.size() + _hints0.size()) * sizeof(std::size_t);
+}
+
+
+std::size_t rankSelect::blockZeros(std::size_t block) const
+{
+	return block * _BLOCK_WORDS * 64 - _ranks[block];
+}
\ No newline at end of file
@@ -0,0 +1,252 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: segmentedNumMixer.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * Each built prefix vector has one entry per segment plus a final total, so
+// its last entry is the size of its union. _sizePrefix is always built; the
+// even and odd ones are built together or both empty.
+
+
+#include <ctime>  // time
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <algorithm>  // upper_bound
+#include <memory>  // make_shared
+#include <random>  // mt19937, uniform_int_distribution
+#include <string>  // string
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+#include "../include/numDataset.h"
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+#include "../include/segmentedNumMixer.h"
+
+
+template <class T, class Engine>
+basicSegmentedNumMixer<T, Engine>::basicSegmentedNumMixer():
+	_segments(),
+	_sizePrefix(1, 0),
+	_evenPrefix(),
+	_oddPrefix(),
+	_stateChangeCount(0),
+	_countDown(0),
+	_eng(time(0)),
+	_controllerState(MIX)
+{
+	// calc max ping count
+	const int LOWER_BOUND = 10;
+	const int UPPER_BOUND = 20;
+	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
+	_countDown = distr(_eng);
+}
+
+
+template <class T, class Engine>
+basicSegmentedNumMixer<T, Engine>::basicSegmentedNumMixer(
+	const std::vector<basicNumDatasetHandle<T> >& segments):
+	basicSegmentedNumMixer()
+{
+	for (std::size_t i = 0; i < segments.size(); ++i) {
+		if (segments[i]) {
+			_segments.push_back(segments[i]);
+		}
+	}
+	indexSegments();
+}
+
+
+template <class T, class Engine>
+bool basicSegmentedNumMixer<T, Engine>::ping(std::vector<T>& returnValues)
+{
+	if (isActive() && checkStateValid()) {
+		const std::vector<std::size_t>& prefix = controllerPrefix();
+		for (std::size_t i = 0; i < returnValues.size(); ++i) {
+			returnValues[i] = drawValue(prefix);
+		}
+		--_countDown;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+
+template <class T, class Engine>
+void basicSegmentedNumMixer<T, Engine>::seed(std::uint64_t value)
+{
+	_eng.seed(value);
+}
+
+
+template <class T, class Engine>
+void basicSegmentedNumMixer<T, Engine>::setControllerState(
+	OutputController state)
+{
+	if (getControllerState() != state) {
+		_controllerState = state;
+		++_stateChangeCount;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicSegmentedNumMixer<T, Engine>::addSegment(
+	basicNumDatasetHandle<T> segment)
+{
+	if (!segment) {
+		return false;
+	}
+	_segments.push_back(segment);
+	indexSegments();
+	return true;
+}
+
+
+template <class T, class Engine>
+bool basicSegmentedNumMixer<T, Engine>::addSegment(std::vector<T>&& values)
+{
+	return addSegment(
+		std::make_shared<const basicNumDataset<T> >(std::move(values)));
+}
+
+
+template <class T, class Engine>
+bool basicSegmentedNumMixer<T, Engine>::addSegment(const std::string& path,
+                                                   int mapFlags)
+{
+	basicNumDatasetHandle<T> segment =
+		std::make_shared<const basicNumDataset<T> >(path, mapFlags);
+	return segment->isMapped() && addSegment(segment);
+}
+
+
+template <class T, class Engine>
+bool basicSegmentedNumMixer<T, Engine>::removeSegment(std::size_t i)
+{
+	if (i >= _segments.size()) {
+		return false;
+	}
+	_segments.erase(_segments.begin() + i);
+	indexSegments();
+	return true;
+}
+
+
+template <class T, class Engine>
+void basicSegmentedNumMixer<T, Engine>::indexSegments()
+{
+	_sizePrefix.assign(1, 0);
+	for (std::size_t s = 0; s < _segments.size(); ++s) {
+		_sizePrefix.push_back(_sizePrefix.back() + _segments[s]->size());
+	}
+	_evenPrefix.clear();
+	_oddPrefix.clear();
+}
+
+
+template <class T, class Engine>
+void basicSegmentedNumMixer<T, Engine>::indexParity()
+{
+	if (!_evenPrefix.empty()) {
+		return;
+	}
+	_evenPrefix.assign(1, 0);
+	_oddPrefix.assign(1, 0);
+	for (std::size_t s = 0; s < _segments.size(); ++s) {
+		_evenPrefix.push_back(_evenPrefix.back() + _segments[s]->evenCount());
+		_oddPrefix.push_back(_oddPrefix.back() + _segments[s]->oddCount());
+	}
+}
+
+
+template <class T, class Engine>
+const std::vector<std::size_t>&
+basicSegmentedNumMixer<T, Engine>::controllerPrefix() const
+{
+	if (_controllerState == EVEN) {
+		return _evenPrefix;
+	} else if (_controllerState == ODD) {
+		return _oddPrefix;
+	} else {
+		return _sizePrefix;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicSegmentedNumMixer<T, Engine>::checkStateValid()
+{
+	switch (_controllerState) {
+		case MIX:
+			return (_sizePrefix.back() > 0);
+		case EVEN:
+			indexParity();
+			return (_evenPrefix.back() > 0);
+		case ODD:
+			indexParity();
+			return (_oddPrefix.back() > 0);
+		default:
+			return false;
+	}
+}
+
+
+template <class T, class Engine>
+T basicSegmentedNumMixer<T, Engine>::drawValue(
+	const std::vector<std::size_t>& prefix)
+{
+	// an index into the union, then the last segment starting at or before it
+	const std::size_t j = boundedRand(_eng, prefix.back());
+	const std::size_t s = std::upper_bound(prefix.begin() + 1, prefix.end(), j)
+	                      - prefix.begin() - 1;
+	const basicNumDataset<T>& segment = *_segments[s];
+	const std::size_t local = j - prefix[s];
+	if (_controllerState == EVEN) {
+		return segment.evenAt(local);
+	} else if (_controllerState == ODD) {
+		return segment.oddAt(local);
+	} else {
+		return segment.at(local);
+	}
+}
+
+
+// supported element types and engines
+template class basicSegmentedNumMixer<std::int8_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::int8_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::int8_t, pcg64>;
+template class basicSegmentedNumMixer<std::int8_t, splitMix64>;
+template class basicSegmentedNumMixer<std::uint8_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::uint8_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::uint8_t, pcg64>;
+template class basicSegmentedNumMixer<std::uint8_t, splitMix64>;
+template class basicSegmentedNumMixer<std::int16_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::int16_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::int16_t, pcg64>;
+template class basicSegmentedNumMixer<std::int16_t, splitMix64>;
+template class basicSegmentedNumMixer<std::uint16_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::uint16_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::uint16_t, pcg64>;
+template class basicSegmentedNumMixer<std::uint16_t, splitMix64>;
+template class basicSegmentedNumMixer<int, std::mt19937>;
+template class basicSegmentedNumMixer<int, xoshiro256ss>;
+template class basicSegmentedNumMixer<int, pcg64>;
+template class basicSegmentedNumMixer<int, splitMix64>;
+template class basicSegmentedNumMixer<std::uint32_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::uint32_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::uint32_t, pcg64>;
+template class basicSegmentedNumMixer<std::uint32_t, splitMix64>;
+template class basicSegmentedNumMixer<std::int64_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::int64_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::int64_t, pcg64>;
+template class basicSegmentedNumMixer<std::int64_t, splitMix64>;
+template class basicSegmentedNumMixer<std::uint64_t, std::mt19937>;
+template class basicSegmentedNumMixer<std::uint64_t, xoshiro256ss>;
+template class basicSegmentedNumMixer<std::uint64_t, pcg64>;
+template class basicSegmentedNumMixer<std::uint64_t, splitMix64>;
\ No newline at end of file
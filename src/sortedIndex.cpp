@@ -0,0 +1,245 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: sortedIndex.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _tree has one entry per block plus the unused entry 0, and holds _size
+// in total.
+// * Equal values keep no particular order, and may span blocks.
+
+
+#include <cstddef>  // size_t, ptrdiff_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <algorithm>  // min, lower_bound, upper_bound
+#include <utility>  // move
+#include <vector>  // vector
+
+
+#include "../include/sortedIndex.h"
+
+
+template <class T>
+const std::size_t basicSortedIndex<T>::_BLOCK_SIZE;
+
+
+template <class T>
+basicSortedIndex<T>::basicSortedIndex():
+	_blocks(),
+	_tree(1, 0),
+	_size(0),
+	_uniform(true)
+{
+}
+
+
+template <class T>
+basicSortedIndex<T>::basicSortedIndex(const std::vector<T>& sorted):
+	_blocks(),
+	_tree(),
+	_size(sorted.size()),
+	_uniform(true)
+{
+	_blocks.reserve((_size + _BLOCK_SIZE - 1) / _BLOCK_SIZE);
+	for (std::size_t begin = 0; begin < _size; begin += _BLOCK_SIZE) {
+		const std::size_t end = std::min(_size, begin + _BLOCK_SIZE);
+		_blocks.push_back(std::vector<T>(sorted.begin() + begin,
+		                                 sorted.begin() + end));
+	}
+	buildTree();
+}
+
+
+template <class T>
+void basicSortedIndex<T>::insert(T value)
+{
+	_uniform = false;
+	if (_blocks.empty()) {
+		_blocks.push_back(std::vector<T>(1, value));
+		buildTree();
+		++_size;
+		return;
+	}
+
+	// after any equal values: into the first block whose last value is
+	// greater, or the last block
+	std::size_t block = std::upper_bound(
+		_blocks.begin(), _blocks.end(), value,
+		[](T v, const std::vector<T>& b) { return v < b.back(); })
+		- _blocks.begin();
+	block = std::min(block, _blocks.size() - 1);
+	std::vector<T>& values = _blocks[block];
+	values.insert(std::upper_bound(values.begin(), values.end(), value),
+	              value);
+	++_size;
+
+	if (values.size() >= 2 * _BLOCK_SIZE) {
+		// split in two halves
+		std::vector<T> upper(values.begin() + _BLOCK_SIZE, values.end());
+		values.resize(_BLOCK_SIZE);
+		_blocks.insert(_blocks.begin() + block + 1, std::move(upper));
+		buildTree();
+	} else {
+		resized(block, 1);
+	}
+}
+
+
+template <class T>
+void basicSortedIndex<T>::erase(T value)
+{
+	_uniform = false;
+
+	// the first block whose last value is not less than "value" holds it
+	const std::size_t block = std::lower_bound(
+		_blocks.begin(), _blocks.end(), value,
+		[](const std::vector<T>& b, T v) { return b.back() < v; })
+		- _blocks.begin();
+	std::vector<T>& values = _blocks[block];
+	values.erase(std::lower_bound(values.begin(), values.end(), value));
+	--_size;
+
+	if (values.empty()) {
+		_blocks.erase(_blocks.begin() + block);
+		buildTree();
+	} else {
+		resized(block, -1);
+	}
+}
+
+
+template <class T>
+std::size_t basicSortedIndex<T>::lowerBound(T value) const
+{
+	const std::size_t block = std::lower_bound(
+		_blocks.begin(), _blocks.end(), value,
+		[](const std::vector<T>& b, T v) { return b.back() < v; })
+		- _blocks.begin();
+	if (block == _blocks.size()) {
+		return _size;
+	}
+	const std::vector<T>& values = _blocks[block];
+	return prefix(block)
+	       + (std::lower_bound(values.begin(), values.end(), value)
+	          - values.begin());
+}
+
+
+template <class T>
+std::size_t basicSortedIndex<T>::upperBound(T value) const
+{
+	const std::size_t block = std::upper_bound(
+		_blocks.begin(), _blocks.end(), value,
+		[](T v, const std::vector<T>& b) { return v < b.back(); })
+		- _blocks.begin();
+	if (block == _blocks.size()) {
+		return _size;
+	}
+	const std::vector<T>& values = _blocks[block];
+	return prefix(block)
+	       + (std::upper_bound(values.begin(), values.end(), value)
+	          - values.begin());
+}
+
+
+template <class T>
+const T* basicSortedIndex<T>::run(std::size_t begin, std::size_t end) const
+{
+	if (begin == end) {
+		return nullptr;
+	}
+	std::size_t offset;
+	const std::size_t block = locate(begin, offset);
+	if (offset + (end - begin) <= _blocks[block].size()) {
+		return _blocks[block].data() + offset;
+	} else {
+		return nullptr;
+	}
+}
+
+
+template <class T>
+std::size_t basicSortedIndex<T>::memoryUsage() const
+{
+	std::size_t bytes = _tree.size() * sizeof(std::size_t)
+	                    + _blocks.size() * sizeof(std::vector<T>);
+	for (std::size_t b = 0; b < _blocks.size(); ++b) {
+		bytes += _blocks[b].capacity() * sizeof(T);
+	}
+	return bytes;
+}
+
+
+template <class T>
+std::size_t basicSortedIndex<T>::locate(std::size_t p,
+                                        std::size_t& offset) const
+{
+	if (_uniform) {
+		offset = p & (_BLOCK_SIZE - 1);
+		return p >> _BLOCK_BITS;
+	}
+
+	// descend the tree to the block holding position p
+	const std::size_t blocks = _tree.size() - 1;
+	std::size_t block = 0;
+	std::size_t remaining = p;
+	for (std::size_t step = std::size_t(1) << (63 - __builtin_clzll(blocks));
+	     step > 0; step >>= 1) {
+		if (block + step <= blocks && _tree[block + step] <= remaining) {
+			block += step;
+			remaining -= _tree[block];
+		}
+	}
+	offset = remaining;
+	return block;
+}
+
+
+template <class T>
+std::size_t basicSortedIndex<T>::prefix(std::size_t blocks) const
+{
+	if (_uniform) {
+		return blocks << _BLOCK_BITS;
+	}
+	std::size_t count = 0;
+	for (std::size_t i = blocks; i > 0; i -= i & (0 - i)) {
+		count += _tree[i];
+	}
+	return count;
+}
+
+
+template <class T>
+void basicSortedIndex<T>::buildTree()
+{
+	const std::size_t blocks = _blocks.size();
+	_tree.assign(blocks + 1, 0);
+	for (std::size_t i = 1; i <= blocks; ++i) {
+		_tree[i] += _blocks[i - 1].size();
+		const std::size_t parent = i + (i & (0 - i));
+		if (parent <= blocks) {
+			_tree[parent] += _tree[i];
+		}
+	}
+}
+
+
+template <class T>
+void basicSortedIndex<T>::resized(std::size_t block, std::ptrdiff_t delta)
+{
+	for (std::size_t i = block + 1; i < _tree.size(); i += i & (0 - i)) {
+		_tree[i] += delta;
+	}
+}
+
+
+// supported element types
+template class basicSortedIndex<std::int8_t>;
+template class basicSortedIndex<std::uint8_t>;
+template class basicSortedIndex<std::int16_t>;
+template class basicSortedIndex<std::uint16_t>;
+template class basicSortedIndex<int>;
+template class basicSortedIndex<std::uint32_t>;
+template class basicSortedIndex<std::int64_t>;
+template class basicSortedIndex<std::uint64_t>;
\ No newline at end of file
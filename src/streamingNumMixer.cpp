@@ -0,0 +1,402 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: streamingNumMixer.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _back, the index in _middle and _front are always a permutation of 0, 1
+// and 2, so the ingesting thread and the pinging thread never touch the same
+// buffer.
+// * A full reservoir's next index is always at least its seen count: the
+// values before it have been skipped.
+// * _reservoirs, _states and _ingestEng are only touched by the ingesting
+// thread while _ingesting is set, and by offer() otherwise.
+
+
+#include <ctime>  // time
+#include <cerrno>  // errno, EINTR
+#include <cstddef>  // size_t
+#include <cstdint>  // int8_t, ..., uint64_t
+#include <cstring>  // memcpy, memmove
+#include <cmath>  // exp, floor, ldexp, log, log1p
+#include <exception>  // exception_ptr, current_exception
+#include <functional>  // function
+#include <ios>  // ios_base
+#include <istream>  // istream
+#include <random>  // mt19937, uniform_int_distribution
+#include <system_error>  // system_error, generic_category
+#include <thread>  // thread
+#include <type_traits>  // make_unsigned
+#include <vector>  // vector
+
+
+#if defined(_WIN32)
+#include <io.h>  // _read
+#else
+#include <unistd.h>  // read
+#endif
+
+
+#include "../include/boundedRand.h"
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+#include "../include/streamingNumMixer.h"
+
+
+template <class T, class Engine>
+const unsigned basicStreamingNumMixer<T, Engine>::_FRESH;
+
+
+template <class T, class Engine>
+basicStreamingNumMixer<T, Engine>::basicStreamingNumMixer(
+	std::size_t capacity):
+	_capacity(capacity > 0 ? capacity : 1),
+	_reservoirs(),
+	_states(),
+	_ingestEng(splitMix64(time(0))()),
+	_buffers(),
+	_back(0),
+	_middle(1),
+	_front(2),
+	_seen(0),
+	_thread(),
+	_ingesting(false),
+	_stopping(false),
+	_error(),
+	_stateChangeCount(0),
+	_countDown(0),
+	_eng(time(0)),
+	_controllerState(MIX)
+{
+	for (int c = 0; c < 3; ++c) {
+		_reservoirs[c].reserve(_capacity);
+		_states[c].seen = 0;
+		_states[c].next = 0;
+		_states[c].weight = 0;
+		for (int b = 0; b < 3; ++b) {
+			_buffers[b].reservoirs[c].reserve(_capacity);
+		}
+	}
+
+	// calc max ping count
+	const int LOWER_BOUND = 10;
+	const int UPPER_BOUND = 20;
+	std::uniform_int_distribution<> distr(LOWER_BOUND, UPPER_BOUND);
+	_countDown = distr(_eng);
+}
+
+
+template <class T, class Engine>
+basicStreamingNumMixer<T, Engine>::~basicStreamingNumMixer()
+{
+	stop();
+}
+
+
+template <class T, class Engine>
+bool basicStreamingNumMixer<T, Engine>::ingest(std::istream& in)
+{
+	return start([&in](char* buffer, std::size_t bytes) -> std::size_t {
+		in.read(buffer, bytes);
+		if (in.bad()) {
+			throw std::ios_base::failure("streamingNumMixer: read failed");
+		}
+		return static_cast<std::size_t>(in.gcount());
+	});
+}
+
+
+template <class T, class Engine>
+bool basicStreamingNumMixer<T, Engine>::ingest(int fd)
+{
+	return start([fd](char* buffer, std::size_t bytes) -> std::size_t {
+		for (;;) {
+#if defined(_WIN32)
+			const int got = _read(fd, buffer, static_cast<unsigned>(bytes));
+#else
+			const ssize_t got = read(fd, buffer, bytes);
+#endif
+			if (got >= 0) {
+				return static_cast<std::size_t>(got);
+			} else if (errno != EINTR) {
+				throw std::system_error(errno, std::generic_category(),
+				                        "streamingNumMixer: read failed");
+			}
+		}
+	});
+}
+
+
+template <class T, class Engine>
+bool basicStreamingNumMixer<T, Engine>::offer(const T* values,
+                                              std::size_t count)
+{
+	if (_ingesting) {
+		return false;
+	}
+	consume(values, count);
+	publish();
+	return true;
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::stop()
+{
+	_stopping = true;
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+	_stopping = false;
+}
+
+
+template <class T, class Engine>
+bool basicStreamingNumMixer<T, Engine>::ping(std::vector<T>& returnValues)
+{
+	if (!isActive()) {
+		return false;
+	}
+
+	// pick up the newest published reservoirs, if any
+	if (_middle.load() & _FRESH) {
+		_front = _middle.exchange(_front) & ~_FRESH;
+	}
+
+	if (_controllerState != MIX && _controllerState != EVEN
+	    && _controllerState != ODD) {
+		return false;
+	}
+	const std::vector<T>& reservoir =
+		_buffers[_front].reservoirs[_controllerState];
+	if (reservoir.empty()) {
+		return false;
+	}
+
+	for (std::size_t i = 0; i < returnValues.size(); ++i) {
+		returnValues[i] = reservoir[boundedRand(_eng, reservoir.size())];
+	}
+	--_countDown;
+	return true;
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::seed(std::uint64_t value)
+{
+	_eng.seed(value);
+	if (!_ingesting) {
+		splitMix64 seeder(value);
+		_ingestEng.seed(seeder());
+	}
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::setControllerState(
+	OutputController state)
+{
+	if (getControllerState() != state) {
+		_controllerState = state;
+		++_stateChangeCount;
+	}
+}
+
+
+template <class T, class Engine>
+bool basicStreamingNumMixer<T, Engine>::start(
+	const std::function<std::size_t(char*, std::size_t)>& read)
+{
+	if (_ingesting) {
+		return false;
+	}
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+	_error = std::exception_ptr();
+	_ingesting = true;
+	_thread = std::thread(&basicStreamingNumMixer::run, this, read);
+	return true;
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::run(
+	const std::function<std::size_t(char*, std::size_t)>& read)
+{
+	const std::size_t BLOCK_SIZE = 4096;
+	std::size_t pending = 0;
+	std::size_t unpublished = 0;
+
+	try {
+		std::vector<char> bytes(BLOCK_SIZE * sizeof(T));
+		std::vector<T> values(BLOCK_SIZE);
+		while (!_stopping) {
+			const std::size_t wanted = bytes.size() - pending;
+			const std::size_t got = read(bytes.data() + pending, wanted);
+			if (got == 0) {
+				break;
+			}
+			pending += got;
+
+			// whole values go to the reservoirs, a split one waits for the
+			// rest
+			const std::size_t count = pending / sizeof(T);
+			const std::size_t used = count * sizeof(T);
+			std::memcpy(values.data(), bytes.data(), used);
+			std::memmove(bytes.data(), bytes.data() + used, pending - used);
+			pending -= used;
+			consume(values.data(), count);
+			unpublished += count;
+
+			if (got < wanted || unpublished >= _capacity) {
+				publish();
+				unpublished = 0;
+			}
+		}
+	} catch (...) {
+		// a failing read ends the stream; escaping would terminate
+		_error = std::current_exception();
+	}
+
+	if (unpublished > 0) {
+		publish();
+	}
+	_ingesting = false;
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::consume(const T* values,
+                                                std::size_t count)
+{
+	// MIX: fill, then jump straight to the admitted positions of the block
+	reservoirState& mix = _states[MIX];
+	std::vector<T>& reservoir = _reservoirs[MIX];
+	std::size_t i = 0;
+	for (; i < count && reservoir.size() < _capacity; ++i) {
+		reservoir.push_back(values[i]);
+		++mix.seen;
+		if (reservoir.size() == _capacity) {
+			startSkipping(mix);
+		}
+	}
+	const std::uint64_t end = mix.seen + (count - i);
+	while (i < count && mix.next < end) {
+		reservoir[boundedRand(_ingestEng, _capacity)] =
+			values[i + (mix.next - mix.seen)];
+		advance(mix);
+	}
+	mix.seen = end;
+
+	// EVEN/ODD: each value has to be classified to count it
+	typedef typename std::make_unsigned<T>::type unsignedType;
+	for (std::size_t j = 0; j < count; ++j) {
+		admit((static_cast<unsignedType>(values[j]) & 1u) ? ODD : EVEN,
+		      values[j]);
+	}
+
+	_seen += count;
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::admit(OutputController state,
+                                              T value)
+{
+	reservoirState& st = _states[state];
+	std::vector<T>& reservoir = _reservoirs[state];
+	if (reservoir.size() < _capacity) {
+		reservoir.push_back(value);
+		++st.seen;
+		if (reservoir.size() == _capacity) {
+			startSkipping(st);
+		}
+	} else {
+		if (st.seen == st.next) {
+			reservoir[boundedRand(_ingestEng, _capacity)] = value;
+			advance(st);
+		}
+		++st.seen;
+	}
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::startSkipping(reservoirState& state)
+{
+	// the last value kept was seen - 1; advance() skips from there
+	state.weight = 1;
+	state.next = state.seen - 1;
+	advance(state);
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::advance(reservoirState& state)
+{
+	// W *= u^(1/k); the skip is geometric with success probability W
+	const double MAX_SKIP = 4611686018427387904.0;  // 2^62
+	state.weight *= std::exp(std::log(uniform()) / _capacity);
+	const double skip = std::floor(std::log(uniform())
+	                               / std::log1p(-state.weight));
+	state.next += (skip < MAX_SKIP) ? static_cast<std::uint64_t>(skip) + 1
+	                                : static_cast<std::uint64_t>(MAX_SKIP);
+}
+
+
+template <class T, class Engine>
+double basicStreamingNumMixer<T, Engine>::uniform()
+{
+	// 53 random bits, offset by half a step to stay clear of 0 and 1
+	const std::uint64_t high = _ingestEng();
+	const std::uint64_t low = _ingestEng();
+	const std::uint64_t bits = ((high << 32) | low) >> 11;
+	return std::ldexp(static_cast<double>(bits) + 0.5, -53);
+}
+
+
+template <class T, class Engine>
+void basicStreamingNumMixer<T, Engine>::publish()
+{
+	for (int c = 0; c < 3; ++c) {
+		_buffers[_back].reservoirs[c] = _reservoirs[c];
+	}
+	_back = _middle.exchange(_back | _FRESH) & ~_FRESH;
+}
+
+
+// supported element types and engines
+template class basicStreamingNumMixer<std::int8_t, std::mt19937>;
+template class basicStreamingNumMixer<std::int8_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::int8_t, pcg64>;
+template class basicStreamingNumMixer<std::int8_t, splitMix64>;
+template class basicStreamingNumMixer<std::uint8_t, std::mt19937>;
+template class basicStreamingNumMixer<std::uint8_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::uint8_t, pcg64>;
+template class basicStreamingNumMixer<std::uint8_t, splitMix64>;
+template class basicStreamingNumMixer<std::int16_t, std::mt19937>;
+template class basicStreamingNumMixer<std::int16_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::int16_t, pcg64>;
+template class basicStreamingNumMixer<std::int16_t, splitMix64>;
+template class basicStreamingNumMixer<std::uint16_t, std::mt19937>;
+template class basicStreamingNumMixer<std::uint16_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::uint16_t, pcg64>;
+template class basicStreamingNumMixer<std::uint16_t, splitMix64>;
+template class basicStreamingNumMixer<int, std::mt19937>;
+template class basicStreamingNumMixer<int, xoshiro256ss>;
+template class basicStreamingNumMixer<int, pcg64>;
+template class basicStreamingNumMixer<int, splitMix64>;
+template class basicStreamingNumMixer<std::uint32_t, std::mt19937>;
+template class basicStreamingNumMixer<std::uint32_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::uint32_t, pcg64>;
+template class basicStreamingNumMixer<std::uint32_t, splitMix64>;
+template class basicStreamingNumMixer<std::int64_t, std::mt19937>;
+template class basicStreamingNumMixer<std::int64_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::int64_t, pcg64>;
+template class basicStreamingNumMixer<std::int64_t, splitMix64>;
+template class basicStreamingNumMixer<std::uint64_t, std::mt19937>;
+template class basicStreamingNumMixer<std::uint64_t, xoshiro256ss>;
+template class basicStreamingNumMixer<std::uint64_t, pcg64>;
+template class basicStreamingNumMixer<std::uint64_t, splitMix64>;
\ No newline at end of file
@@ -8,22 +8,54 @@
 // * A tmSeer will die after 2 * _k cycles.
 // * An active seer will randomly mix the case of successful requests.
 // * There is a 30% chance to mix a character's case.
+// * Flip masks hold 0x20 for a character to flip and 0 otherwise, so they can
+// be XORed straight into the alphabetic characters.
 
 
 #include <ctime>  // time
-#include <random>  // uniform_int_distribution
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <cstring>  // memcpy
+#include <algorithm>  // min
+#include <random>  // mt19937
 #include <string>  // string
 
 
+#if !defined(TMSEER_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>  // __m256i, _mm256_*
+#define TMSEER_AVX2
+#elif !defined(TMSEER_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>  // __m128i, _mm_*
+#define TMSEER_SSE2
+#endif
+
+
+#include "../include/bitPool.h"
+#include "../include/boundedRand.h"
 #include "../include/tmSeer.h"
+#include "../include/rngEngines.h"
+
+
+static void expandMask(std::uint64_t mask, unsigned char* flips,
+                       std::size_t count);
+
+static void applyFlips(char* text, const unsigned char* flips,
+                       std::size_t count);
+
 
+static const unsigned char CASE_BIT = 0x20;
+// The bit distinguishing an ASCII letter's cases.
 
-tmSeer::tmSeer(int q):
+
+template <class Engine>
+basicTmSeer<Engine>::basicTmSeer(int q):
 	seer(q),
 	_dead(false),
 	_k(q * _Q_MULT),
 	_stateChangeCount(0),
-	_eng()
+	_eng(),
+	_pool(),
+	_compatible(false)
 {
 	_name = "tmSeer";
 	int seed = time(0);
@@ -31,7 +63,8 @@ tmSeer::tmSeer(int q):
 }
 
 
-void tmSeer::request(std::string& fetchedMessage)
+template <class Engine>
+void basicTmSeer<Engine>::request(std::string& fetchedMessage)
 {
 	if (_dead) {
 		fetchedMessage.clear();
@@ -51,7 +84,8 @@ void tmSeer::request(std::string& fetchedMessage)
 }
 
 
-bool tmSeer::active() const
+template <class Engine>
+bool basicTmSeer<Engine>::active() const
 {
 	if (_dead) {
 		return false;
@@ -61,26 +95,159 @@ bool tmSeer::active() const
 }
 
 
-void tmSeer::invertStringCase(std::string& toInvert)
+template <class Engine>
+void basicTmSeer<Engine>::setCompatibilityMode(bool enabled)
 {
-	for (auto& c : toInvert) {
-		const int MIX_CHANCE = 3;
-		if (genRandNum() < 10 - MIX_CHANCE) {
-			continue;
-		} else {
-			if (isupper(c)) {
-				c = tolower(c);
-			} else {
-				c = toupper(c);
-			}
-		}
+	_compatible = enabled;
+}
+
+
+template <class Engine>
+void basicTmSeer<Engine>::invertStringCase(std::string& toInvert)
+{
+	const std::size_t BLOCK_SIZE = 256;
+	unsigned char flips[BLOCK_SIZE];
+	for (std::size_t done = 0; done < toInvert.size(); ) {
+		const std::size_t count = std::min(BLOCK_SIZE,
+		                                   toInvert.size() - done);
+		drawFlips(flips, count);
+		applyFlips(&toInvert[done], flips, count);
+		done += count;
 	}
 }
 
 
-int tmSeer::genRandNum()
+template <class Engine>
+int basicTmSeer<Engine>::genRandNum()
 {
 	const int MAX_ROLL = 9;
-	std::uniform_int_distribution<> distr(0, MAX_ROLL);
-	return distr(_eng);
-}
\ No newline at end of file
+	return static_cast<int>(boundedRand(_eng, MAX_ROLL + 1));
+}
+
+
+template <class Engine>
+void basicTmSeer<Engine>::drawFlips(unsigned char* flips, std::size_t count)
+{
+	const int MIX_CHANCE = 3;
+	const int ROLLS = 10;
+	static const bitPool::probability MIX =
+		bitPool::rational(MIX_CHANCE, ROLLS);
+	if (_compatible) {
+		for (std::size_t i = 0; i < count; ++i) {
+			flips[i] = (genRandNum() < ROLLS - MIX_CHANCE) ? 0 : CASE_BIT;
+		}
+	} else {
+		// 64 decisions per mask, one bit each
+		for (std::size_t done = 0; done < count; done += 64) {
+			const std::size_t lanes = std::min<std::size_t>(64, count - done);
+			expandMask(_pool.bernoulliMask(_eng, MIX,
+			                               static_cast<unsigned>(lanes)),
+			           flips + done, lanes);
+		}
+	}
+}
+
+
+// supported engines
+template class basicTmSeer<std::mt19937>;
+template class basicTmSeer<xoshiro256ss>;
+template class basicTmSeer<pcg64>;
+template class basicTmSeer<splitMix64>;
+
+
+static void expandMask(std::uint64_t mask, unsigned char* flips,
+                       std::size_t count)
+{
+	std::size_t i = 0;
+
+#if defined(TMSEER_AVX2)
+	// every byte of lane j holds mask byte j / 8 (the shuffle works within
+	// 128-bit halves, each holding the 4 bytes); the selector keeps bit j % 8
+	const __m256i spread = _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+	const __m256i selector = _mm256_set1_epi64x(0x8040201008040201LL);
+	const __m256i caseBit = _mm256_set1_epi8(CASE_BIT);
+	for (; i + 32 <= count; i += 32) {
+		const __m256i bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(
+			static_cast<int>(mask >> i)), spread);
+		const __m256i set = _mm256_cmpeq_epi8(
+			_mm256_and_si256(bytes, selector), selector);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(flips + i),
+		                    _mm256_and_si256(set, caseBit));
+	}
+#endif
+
+	// 8 lanes per word: copy the mask byte to every byte, keep bit j of
+	// byte j, and carry it into the byte's top bit (byte j is stored j-th
+	// on the little-endian targets this runs on)
+	const std::uint64_t ONES = 0x0101010101010101ULL;
+	for (; i + 8 <= count; i += 8) {
+		const std::uint64_t bits = ((mask >> i) & 0xFF) * ONES;
+		const std::uint64_t set = ((((bits & 0x8040201008040201ULL)
+		                             + 0x7F7F7F7F7F7F7F7FULL) >> 7) & ONES)
+		                          * CASE_BIT;
+		std::memcpy(flips + i, &set, sizeof(set));
+	}
+
+	for (; i < count; ++i) {
+		flips[i] = ((mask >> i) & 1) ? CASE_BIT : 0;
+	}
+}
+// DESCRIPTION:
+// * Stores CASE_BIT into byte i of "flips" where bit i of "mask" is set, and
+// 0 elsewhere, for the first "count" (at most 64) bytes.
+// * Lanes are expanded 32 at a time with AVX2, 8 at a time in a 64-bit word
+// otherwise, the rest one by one.
+
+
+static void applyFlips(char* text, const unsigned char* flips,
+                       std::size_t count)
+{
+	std::size_t i = 0;
+
+#if defined(TMSEER_AVX2)
+	// folding to lower case and adding 128 - 'a' maps exactly the letters
+	// onto the 26 smallest signed bytes
+	const __m256i caseBit = _mm256_set1_epi8(CASE_BIT);
+	const __m256i offset = _mm256_set1_epi8(static_cast<char>(128 - 'a'));
+	const __m256i bound = _mm256_set1_epi8(-128 + 26);
+	for (; i + 32 <= count; i += 32) {
+		const __m256i x = _mm256_loadu_si256(
+			reinterpret_cast<const __m256i*>(text + i));
+		const __m256i f = _mm256_loadu_si256(
+			reinterpret_cast<const __m256i*>(flips + i));
+		const __m256i letter = _mm256_cmpgt_epi8(bound, _mm256_add_epi8(
+			_mm256_or_si256(x, caseBit), offset));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(text + i),
+		                    _mm256_xor_si256(x, _mm256_and_si256(letter, f)));
+	}
+#elif defined(TMSEER_SSE2)
+	const __m128i caseBit = _mm_set1_epi8(CASE_BIT);
+	const __m128i offset = _mm_set1_epi8(static_cast<char>(128 - 'a'));
+	const __m128i bound = _mm_set1_epi8(-128 + 26);
+	for (; i + 16 <= count; i += 16) {
+		const __m128i x = _mm_loadu_si128(
+			reinterpret_cast<const __m128i*>(text + i));
+		const __m128i f = _mm_loadu_si128(
+			reinterpret_cast<const __m128i*>(flips + i));
+		const __m128i letter = _mm_cmplt_epi8(_mm_add_epi8(
+			_mm_or_si128(x, caseBit), offset), bound);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(text + i),
+		                 _mm_xor_si128(x, _mm_and_si128(letter, f)));
+	}
+#endif
+
+	for (; i < count; ++i) {
+		const unsigned char lower = static_cast<unsigned char>(text[i])
+		                            | CASE_BIT;
+		const unsigned char letter =
+			(static_cast<unsigned char>(lower - 'a') < 26) ? 0xFF : 0;
+		text[i] = static_cast<char>(text[i] ^ (flips[i] & letter));
+	}
+}
+// DESCRIPTION:
+// * Flips the case of each of the "count" characters at "text" that is an
+// ASCII letter and whose byte in "flips" is CASE_BIT.
+// * Lanes are processed 32 (AVX2) or 16 (SSE2) at a time, the rest one by
+// one.
\ No newline at end of file
@@ -53,7 +53,7 @@ void tmVolatileSeer::request(std::string& fetchedMessage)
 	}
 
 	// volatileSeer's implementation
-	if (volatileSeer::genRandNum() < _REJECT_CHANCE) {
+	if (volatileSeer::rejectRequest()) {
 		fetchedMessage.clear();
 	}
 }
\ No newline at end of file
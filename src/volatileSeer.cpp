@@ -11,16 +11,21 @@
 
 
 #include <ctime>  // time
-#include <random>  // uniform_int_distribution
+#include <random>  // mt19937
 #include <string>  // string
 
 
+#include "../include/bitPool.h"
+#include "../include/boundedRand.h"
 #include "../include/volatileSeer.h"
+#include "../include/rngEngines.h"
 
 
-volatileSeer::volatileSeer(int q):
+template <class Engine>
+basicVolatileSeer<Engine>::basicVolatileSeer(int q):
 	seer(q),
-	_eng()
+	_eng(),
+	_pool()
 {
 	_name = "volatileSeer";
 	int seed = time(0);
@@ -28,19 +33,37 @@ volatileSeer::volatileSeer(int q):
 }
 
 
-void volatileSeer::request(std::string& fetchedMessage)
+template <class Engine>
+void basicVolatileSeer<Engine>::request(std::string& fetchedMessage)
 {
 	_message = fetchedMessage;
 	seer::request(fetchedMessage);
-	if (genRandNum() < _REJECT_CHANCE) {
+	if (rejectRequest()) {
 		fetchedMessage.clear();
 	}
 }
 
 
-int volatileSeer::genRandNum()
+template <class Engine>
+int basicVolatileSeer<Engine>::genRandNum()
 {
 	const int MAX_ROLL = 9;
-	std::uniform_int_distribution<> distr(0, MAX_ROLL);
-	return distr(_eng);
-}
\ No newline at end of file
+	return static_cast<int>(boundedRand(_eng, MAX_ROLL + 1));
+}
+
+
+template <class Engine>
+bool basicVolatileSeer<Engine>::rejectRequest()
+{
+	const int ROLLS = 10;
+	static const bitPool::probability REJECT =
+		bitPool::rational(_REJECT_CHANCE, ROLLS);
+	return _pool.bernoulli(_eng, REJECT);
+}
+
+
+// supported engines
+template class basicVolatileSeer<std::mt19937>;
+template class basicVolatileSeer<xoshiro256ss>;
+template class basicVolatileSeer<pcg64>;
+template class basicVolatileSeer<splitMix64>;
\ No newline at end of file
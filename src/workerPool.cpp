@@ -0,0 +1,113 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: workerPool.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// IMPLEMENTATION INVARIANT:
+// * _task, _tasks and _next are only reset while no worker is inside a batch,
+// and are published to the workers under _lock.
+// * _busy is the number of workers that have seen the current batch but not
+// yet finished draining it.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <atomic>  // atomic
+#include <condition_variable>  // condition_variable
+#include <functional>  // function
+#include <mutex>  // mutex, lock_guard, unique_lock
+#include <thread>  // thread, hardware_concurrency
+#include <vector>  // vector
+
+
+#include "../include/workerPool.h"
+
+
+workerPool::workerPool(std::size_t threads):
+	_workers(),
+	_runLock(),
+	_lock(),
+	_wake(),
+	_finished(),
+	_task(nullptr),
+	_tasks(0),
+	_next(0),
+	_busy(0),
+	_batch(0),
+	_stopping(false)
+{
+	if (threads == 0) {
+		threads = std::thread::hardware_concurrency();
+	}
+	for (std::size_t i = 1; i < threads; ++i) {
+		_workers.push_back(std::thread(&workerPool::work, this));
+	}
+}
+
+
+workerPool::~workerPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		_stopping = true;
+	}
+	_wake.notify_all();
+	for (std::size_t i = 0; i < _workers.size(); ++i) {
+		_workers[i].join();
+	}
+}
+
+
+void workerPool::run(std::size_t tasks,
+                     const std::function<void(std::size_t)>& task)
+{
+	std::lock_guard<std::mutex> batchGuard(_runLock);
+
+	// publish the batch and wake the workers
+	{
+		std::lock_guard<std::mutex> guard(_lock);
+		_task = &task;
+		_tasks = tasks;
+		_next = 0;
+		_busy = _workers.size();
+		++_batch;
+	}
+	_wake.notify_all();
+
+	// help, then wait for the workers to leave the batch
+	drain();
+	std::unique_lock<std::mutex> guard(_lock);
+	_finished.wait(guard, [this]() { return _busy == 0; });
+	_task = nullptr;
+}
+
+
+void workerPool::work()
+{
+	std::uint64_t seen = 0;
+	std::unique_lock<std::mutex> guard(_lock);
+	while (true) {
+		_wake.wait(guard, [&]() { return _stopping || _batch != seen; });
+		if (_stopping) {
+			return;
+		}
+		seen = _batch;
+
+		guard.unlock();
+		drain();
+		guard.lock();
+
+		if (--_busy == 0) {
+			_finished.notify_one();
+		}
+	}
+}
+
+
+void workerPool::drain()
+{
+	for (std::size_t i = _next++; i < _tasks; i = _next++) {
+		(*_task)(i);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,248 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: aliasTableTest.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Checks that aliasTable draws each index in proportion to its weight
+// (chi-square test), that zero weights are never drawn, that a total weight
+// of 0 or an invalid weight leaves the table empty, that invalid updates are
+// rejected, and that a rebuild after setWeight() follows the new weights.
+// * Checks numMixer's WEIGHTED controller the same way, with given weights,
+// with weights derived from duplicates, after setWeight(), and with invalid
+// weights, which make WEIGHTED pings fail.
+// * Prints every failing check and returns 1 if any failed, 0 otherwise.
+
+// ASSUMPTIONS:
+// * Engines and mixers are seeded with fixed values, so results are
+// reproducible.
+// * Draws within one ping are independent, so one large ping is a valid
+// sample for the chi-square test.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <limits>  // numeric_limits
+#include <random>  // mt19937
+#include <vector>  // vector
+
+
+#include "../include/aliasTable.h"
+#include "../include/numMixer.h"
+#include "../include/rngEngines.h"
+#include "testUtil.h"
+
+
+const std::size_t SAMPLES = 1 << 18;
+// Draws per frequency check.
+
+
+int failures = 0;
+// The number of failed checks so far.
+
+
+void check(bool passed, const char* what);
+
+std::vector<double> expectedCounts(const std::vector<double>& weights);
+
+bool tableFollows(const aliasTable& table, const std::vector<double>& weights,
+                  wordEngine<std::mt19937>& eng);
+
+bool mixerFollows(numMixer& mixer, const std::vector<int>& values,
+                  const std::vector<double>& weights);
+
+void testTable();
+
+void testInvalidWeights();
+
+void testWeightedMixer();
+
+
+int main()
+{
+	testTable();
+	testInvalidWeights();
+	testWeightedMixer();
+
+	if (failures == 0) {
+		std::printf("aliasTableTest: all checks passed\n");
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+
+void check(bool passed, const char* what)
+{
+	if (!passed) {
+		std::printf("aliasTableTest: %s\n", what);
+		++failures;
+	}
+}
+// DESCRIPTION:
+// * Prints "what" and counts a failure unless "passed".
+
+
+std::vector<double> expectedCounts(const std::vector<double>& weights)
+{
+	double total = 0;
+	for (std::size_t i = 0; i < weights.size(); ++i) {
+		total += weights[i];
+	}
+	std::vector<double> expected(weights.size());
+	for (std::size_t i = 0; i < weights.size(); ++i) {
+		expected[i] = weights[i] / total * SAMPLES;
+	}
+	return expected;
+}
+// DESCRIPTION:
+// * Returns how often SAMPLES weighted draws should return each index.
+
+
+bool tableFollows(const aliasTable& table, const std::vector<double>& weights,
+                  wordEngine<std::mt19937>& eng)
+{
+	std::vector<std::size_t> observed(weights.size(), 0);
+	for (std::size_t s = 0; s < SAMPLES; ++s) {
+		const std::size_t i = table.sample(eng);
+		if (i >= weights.size()) {
+			return false;
+		}
+		++observed[i];
+	}
+	return chiSquarePasses(observed, expectedCounts(weights));
+}
+// DESCRIPTION:
+// * Draws SAMPLES indexes from "table" and returns whether their frequencies
+// fit "weights". Any draw of a zero weight fails.
+
+
+bool mixerFollows(numMixer& mixer, const std::vector<int>& values,
+                  const std::vector<double>& weights)
+{
+	std::vector<int> drawn(SAMPLES);
+	if (!mixer.ping(drawn)) {
+		return false;
+	}
+	std::vector<std::size_t> observed(values.size(), 0);
+	for (std::size_t s = 0; s < SAMPLES; ++s) {
+		std::size_t i = 0;
+		while (i < values.size() && values[i] != drawn[s]) {
+			++i;
+		}
+		if (i == values.size()) {
+			return false;
+		}
+		++observed[i];
+	}
+	return chiSquarePasses(observed, expectedCounts(weights));
+}
+// DESCRIPTION:
+// * Pings SAMPLES values from "mixer", whose controller must be WEIGHTED,
+// and returns whether the frequencies of the distinct "values" fit
+// "weights".
+
+
+void testTable()
+{
+	wordEngine<std::mt19937> eng(2026);
+	std::vector<double> weights = {1, 2, 3, 4, 0, 10, 0.5, 0};
+	aliasTable table(weights);
+	check(!table.empty() && table.totalWeight() == 20.5,
+	      "a table with positive weights is empty or misses weight");
+	check(tableFollows(table, weights, eng),
+	      "draws do not follow the weights, or drew a zero weight");
+
+	// batched updates, then one rebuild
+	check(table.setWeight(0, 0) && table.setWeight(4, 6)
+	      && table.setWeight(5, 1),
+	      "valid weight updates were rejected");
+	weights[0] = 0;
+	weights[4] = 6;
+	weights[5] = 1;
+	table.build();
+	check(tableFollows(table, weights, eng),
+	      "draws after a rebuild do not follow the new weights");
+
+	// updating every weight to 0 empties the table
+	for (std::size_t i = 0; i < weights.size(); ++i) {
+		table.setWeight(i, 0);
+	}
+	table.build();
+	check(table.empty(), "a table whose weights sum to 0 is not empty");
+	check(aliasTable(std::vector<double>(5, 0)).empty()
+	      && aliasTable().empty(),
+	      "a new table with no weight to draw is not empty");
+
+	// and one weight back makes it certain
+	table.setWeight(3, 2);
+	table.build();
+	bool certain = !table.empty();
+	for (int s = 0; s < 1000; ++s) {
+		certain = certain && table.sample(eng) == 3;
+	}
+	check(certain, "a single positive weight is not always drawn");
+}
+// DESCRIPTION:
+// * Checks draws, zero weights, rebuilds and empty tables.
+
+
+void testInvalidWeights()
+{
+	const double INVALID[] = {
+		-1, std::numeric_limits<double>::infinity(),
+		std::numeric_limits<double>::quiet_NaN()
+	};
+	for (double invalid : INVALID) {
+		check(aliasTable(std::vector<double>{1, invalid, 2}).empty(),
+		      "a table built with an invalid weight is not empty");
+
+		aliasTable table(std::vector<double>{1, 2});
+		check(!table.setWeight(0, invalid) && table.weight(0) == 1,
+		      "an invalid weight update was accepted");
+		check(!table.setWeight(2, 1), "an out of range update was accepted");
+	}
+}
+// DESCRIPTION:
+// * Checks negative, infinite and NaN weights at construction and in
+// updates.
+
+
+void testWeightedMixer()
+{
+	const std::vector<int> values = {10, 20, 30, 40};
+	std::vector<double> weights = {1, 0, 3, 4};
+	numMixer mixer(values, weights);
+	mixer.seed(7);
+	mixer.setControllerState(numMixer::WEIGHTED);
+	check(mixerFollows(mixer, values, weights),
+	      "WEIGHTED pings do not follow the given weights");
+
+	check(mixer.setWeight(1, 2) && mixer.setWeight(3, 0),
+	      "valid numMixer weight updates were rejected");
+	weights[1] = 2;
+	weights[3] = 0;
+	check(mixerFollows(mixer, values, weights),
+	      "WEIGHTED pings after setWeight() do not follow the new weights");
+	check(!mixer.setWeight(4, 1) && !mixer.setWeight(0, -1),
+	      "an invalid numMixer weight update was accepted");
+
+	// weights from duplicates: distinct values in ascending order
+	numMixer duplicates(std::vector<int>{7, 5, 7, 9, 7, 5},
+	                    std::vector<double>());
+	duplicates.seed(8);
+	duplicates.setControllerState(numMixer::WEIGHTED);
+	check(mixerFollows(duplicates, {5, 7, 9}, {2, 3, 1}),
+	      "WEIGHTED pings do not follow the duplicate counts");
+
+	// invalid weights and all-zero weights make WEIGHTED pings fail
+	std::vector<int> drawn(16);
+	numMixer invalid(values, std::vector<double>{1, -1, 1, 1});
+	invalid.setControllerState(numMixer::WEIGHTED);
+	check(!invalid.ping(drawn), "a WEIGHTED ping with invalid weights passed");
+	numMixer zero(values, std::vector<double>(values.size(), 0));
+	zero.setControllerState(numMixer::WEIGHTED);
+	check(!zero.ping(drawn), "a WEIGHTED ping with zero total weight passed");
+}
+// DESCRIPTION:
+// * Checks numMixer's WEIGHTED controller over given and derived weights.
\ No newline at end of file
@@ -0,0 +1,139 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: boundedRandTest.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Checks that boundedRand() is uniform with a chi-square test, for every
+// supported engine and for small, prime, power-of-two and wide ranges
+// (including ranges past 2^32, which 32-bit engines draw from two words).
+// * Large ranges are tested twice: bucketed by their high part, which catches
+// skew towards one end, and by their low 6 bits, which catches modulo bias.
+// * Prints every failing case and returns 1 if any failed, 0 otherwise.
+
+// ASSUMPTIONS:
+// * Engines are seeded with fixed values, so results are reproducible and a
+// passing build keeps passing.
+// * A case fails when its statistic exceeds the chi-square limit of
+// testUtil.h, so a uniform generator fails a given case with probability
+// 10^-4.
+
+
+#include <cstddef>  // size_t
+#include <cstdint>  // uint64_t
+#include <cstdio>  // printf
+#include <random>  // mt19937
+#include <vector>  // vector
+
+
+#include "../include/boundedRand.h"
+#include "../include/rngEngines.h"
+#include "testUtil.h"
+
+
+const std::size_t SAMPLES = 1 << 20;
+// Draws per case.
+
+const std::uint64_t MAX_BUCKETS = 64;
+// Ranges above it are bucketed.
+
+
+template <class Engine>
+int testEngine(const char* engineName);
+
+template <class Engine>
+bool testRange(Engine& eng, std::uint64_t range, bool lowBits);
+
+
+int main()
+{
+	int failures = 0;
+	failures += testEngine<std::mt19937>("mt19937");
+	failures += testEngine<xoshiro256ss>("xoshiro256ss");
+	failures += testEngine<pcg64>("pcg64");
+	failures += testEngine<splitMix64>("splitMix64");
+
+	if (failures == 0) {
+		std::printf("boundedRandTest: all ranges uniform\n");
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+
+template <class Engine>
+int testEngine(const char* engineName)
+{
+	const std::uint64_t RANGES[] = {
+		// small
+		2, 3, 6, 10, 52,
+		// prime
+		7, 61, 1000003, 4294967291ULL, 18446744073709551557ULL,
+		// power of two
+		8, 64, 1 << 20, 1ULL << 32, 1ULL << 63,
+		// wide: most rejections for 32-bit and 64-bit words, most modulo
+		// bias (2/3 of the word), and two words
+		(1ULL << 31) + 1, (1ULL << 63) + 1, 3000000000ULL,
+		12297829382473034411ULL, (1ULL << 32) + 15
+	};
+	Engine eng(2026);
+	int failures = 0;
+	for (std::uint64_t range : RANGES) {
+		for (int lowBits = 0; lowBits < 2; ++lowBits) {
+			if ((lowBits == 1) && (range <= MAX_BUCKETS)) {
+				continue;
+			}
+			if (!testRange(eng, range, lowBits == 1)) {
+				std::printf("boundedRandTest: %s is not uniform over "
+				            "[0, %llu) (%s)\n", engineName,
+				            static_cast<unsigned long long>(range),
+				            lowBits ? "low bits" : "high part");
+				++failures;
+			}
+		}
+	}
+	return failures;
+}
+// DESCRIPTION:
+// * Tests every range with one engine and returns the number of failures.
+
+
+template <class Engine>
+bool testRange(Engine& eng, std::uint64_t range, bool lowBits)
+{
+	// buckets of equal width, except possibly the last
+	const std::uint64_t buckets = lowBits ? MAX_BUCKETS
+	                              : (range < MAX_BUCKETS) ? range : MAX_BUCKETS;
+	const std::uint64_t width = range / buckets + (range % buckets != 0);
+	std::vector<double> expected(buckets);
+	for (std::uint64_t b = 0; b < buckets; ++b) {
+		if (lowBits) {
+			// values with these low bits: one per full block of 64, plus one
+			// if the partial block reaches b
+			const std::uint64_t count = range / MAX_BUCKETS
+			                            + (b < range % MAX_BUCKETS);
+			expected[b] = static_cast<double>(count) / range * SAMPLES;
+		} else {
+			const std::uint64_t first = b * width;
+			const std::uint64_t size = (range - first < width)
+			                           ? range - first : width;
+			expected[b] = static_cast<double>(size) / range * SAMPLES;
+		}
+	}
+
+	std::vector<std::size_t> observed(buckets, 0);
+	for (std::size_t i = 0; i < SAMPLES; ++i) {
+		const std::uint64_t value = boundedRand(eng, range);
+		if (value >= range) {
+			return false;
+		}
+		++observed[lowBits ? (value % MAX_BUCKETS) : (value / width)];
+	}
+
+	return chiSquarePasses(observed, expected);
+}
+// DESCRIPTION:
+// * Draws SAMPLES values in [0, "range") from "eng", counts them per bucket
+// (by value, by high part, or by the low 6 bits if "lowBits" is true) and
+// returns whether the chi-square statistic is within the limit. Any value
+// out of range fails the case.
\ No newline at end of file
@@ -0,0 +1,297 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: mutationTest.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Checks numMixer::append(), remove() and update(): after a random
+// sequence of mutations, every controller (EVEN, ODD, RANGE, a residue and
+// a predicate controller) draws from exactly the values a numMixer rebuilt
+// from scratch over the same values draws from.
+// * A controller's population is compared as a multiset: a unique ping of
+// its whole size must return it, and one more value must fail. A plain ping
+// must only return members.
+// * Sequences run over owned and over borrowed datasets (copied on the first
+// mutation), and range from a single mutation to a few hundred.
+// * Prints every failing check and returns 1 if any failed, 0 otherwise.
+
+// ASSUMPTIONS:
+// * The random sequences are seeded with fixed values, so results are
+// reproducible.
+// * A failing unique ping leaves the countdown untouched, so each mixer
+// only spends the 10 pings every countdown allows.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <algorithm>  // binary_search, find, sort
+#include <functional>  // function
+#include <random>  // mt19937, uniform_int_distribution
+#include <string>  // string
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+
+
+const int LOW_VALUE = -32;
+const int HIGH_VALUE = 95;
+// The values stored in the datasets, duplicates included.
+
+const int RANGE_LOW = 10;
+const int RANGE_HIGH = 40;
+// The bounds of the RANGE controller.
+
+const std::size_t INITIAL_SIZE = 200;
+// Values in each dataset before its mutations.
+
+const std::size_t SEQUENCES = 200;
+// Random mutation sequences per kind of dataset.
+
+
+int failures = 0;
+// The number of failed checks so far.
+
+
+void check(bool passed, const char* what);
+
+bool isResidue(int value);
+
+bool isLarge(int value);
+
+void prepare(numMixer& mixer);
+
+std::vector<int> members(const std::vector<int>& values,
+                         numMixer::OutputController state);
+
+void checkPopulation(numMixer& mixer, const std::vector<int>& expected,
+                     const char* what);
+
+void checkDraws(numMixer& mixer, const std::vector<int>& expected,
+                const char* what);
+
+void mutateAndCheck(numMixer& mixer, std::vector<int> model,
+                    std::mt19937& eng, std::size_t length);
+
+void testSequence(std::mt19937& eng, bool borrowed, std::size_t length);
+
+
+int main()
+{
+	std::mt19937 eng(17);
+	for (std::size_t s = 0; s < SEQUENCES; ++s) {
+		// mostly short sequences, where the first mutations switch the
+		// controllers' bitmaps, and some long ones
+		const std::size_t length = (s % 10 == 9) ? 300 : s % 10 + 1;
+		testSequence(eng, false, length);
+		testSequence(eng, true, length);
+	}
+
+	if (failures == 0) {
+		std::printf("mutationTest: all checks passed\n");
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+
+void check(bool passed, const char* what)
+{
+	if (!passed) {
+		std::printf("mutationTest: %s\n", what);
+		++failures;
+	}
+}
+// DESCRIPTION:
+// * Prints "what" and counts a failure unless "passed".
+
+
+bool isResidue(int value)
+{
+	return ((value % 3) + 3) % 3 == 2;
+}
+// DESCRIPTION:
+// * Returns whether "value" is congruent to 2 modulo 3, negative values
+// included: the residue controller's members.
+
+
+bool isLarge(int value)
+{
+	return value > 50;
+}
+// DESCRIPTION:
+// * The predicate controller's members.
+
+
+void prepare(numMixer& mixer)
+{
+	mixer.seed(1);
+	mixer.addResidueController("residue", 3, 2);
+	mixer.addPredicateController("large", isLarge);
+	mixer.buildRangeIndex();
+	mixer.setRange(RANGE_LOW, RANGE_HIGH);
+}
+// DESCRIPTION:
+// * Registers the controllers under test on "mixer".
+
+
+std::vector<int> members(const std::vector<int>& values,
+                         numMixer::OutputController state)
+{
+	std::vector<int> result;
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		const int value = values[i];
+		bool member = false;
+		switch (state) {
+			case numMixer::EVEN:
+				member = value % 2 == 0;
+				break;
+			case numMixer::ODD:
+				member = value % 2 != 0;
+				break;
+			case numMixer::RANGE:
+				member = value >= RANGE_LOW && value <= RANGE_HIGH;
+				break;
+			case numMixer::FIRST_CUSTOM:
+				member = isResidue(value);
+				break;
+			default:
+				member = isLarge(value);
+				break;
+		}
+		if (member) {
+			result.push_back(value);
+		}
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+// DESCRIPTION:
+// * Returns the sorted values of "values" that the controller "state" draws
+// from, FIRST_CUSTOM + 1 being the predicate controller.
+
+
+void checkPopulation(numMixer& mixer, const std::vector<int>& expected,
+                     const char* what)
+{
+	std::vector<int> values(expected.size() + 1);
+	check(!mixer.pingUnique(values), what);
+	if (expected.empty()) {
+		return;
+	}
+	values.pop_back();
+	check(mixer.pingUnique(values), what);
+	std::sort(values.begin(), values.end());
+	check(values == expected, what);
+}
+// DESCRIPTION:
+// * Checks that the population of "mixer"'s controller is "expected": one
+// value more cannot be drawn uniquely, and a unique ping of all of them
+// returns them. Spends at most one ping of the countdown.
+
+
+void checkDraws(numMixer& mixer, const std::vector<int>& expected,
+                const char* what)
+{
+	if (expected.empty()) {
+		return;
+	}
+	std::vector<int> values(64);
+	check(mixer.ping(values), what);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		check(std::binary_search(expected.begin(), expected.end(),
+		                         values[i]), what);
+	}
+}
+// DESCRIPTION:
+// * Checks that a ping of "mixer"'s controller only returns values of
+// "expected". Spends at most one ping of the countdown.
+
+
+void mutateAndCheck(numMixer& mixer, std::vector<int> model,
+                    std::mt19937& eng, std::size_t length)
+{
+	std::uniform_int_distribution<int> valueDistr(LOW_VALUE, HIGH_VALUE);
+	prepare(mixer);
+
+	// mirror every mutation on "model", a plain multiset of the values
+	for (std::size_t m = 0; m < length; ++m) {		const unsigned kind = eng() % 3;
+		const std::size_t size = mixer.datasetSize();
+		if (kind == 0 || size == 0) {
+			const int value = valueDistr(eng);
+			check(mixer.append(value), "append failed");
+			model.push_back(value);
+			continue;
+		}
+		const std::size_t i = eng() % size;
+		const int old = mixer.dataset()->at(i);
+		std::vector<int>::iterator found =
+			std::find(model.begin(), model.end(), old);
+		if (found == model.end()) {
+			check(false, "the dataset holds a value never stored");
+			return;
+		}
+		if (kind == 1) {
+			check(mixer.remove(i), "remove failed");
+			model.erase(found);
+		} else {
+			const int value = valueDistr(eng);
+			check(mixer.update(i, value), "update failed");
+			*found = value;
+		}
+	}
+
+	std::vector<int> stored = mixer.dataset()->toPartitionedVector();
+	std::sort(stored.begin(), stored.end());
+	std::vector<int> sortedModel = model;
+	std::sort(sortedModel.begin(), sortedModel.end());
+	check(stored == sortedModel, "the dataset lost or invented values");
+
+	numMixer rebuilt(model);
+	prepare(rebuilt);
+	const numMixer::OutputController states[] = {
+		numMixer::EVEN, numMixer::ODD, numMixer::RANGE,
+		numMixer::FIRST_CUSTOM,
+		static_cast<numMixer::OutputController>(numMixer::FIRST_CUSTOM + 1)
+	};
+	const char* const names[] = {
+		"EVEN draws differ from a rebuilt dataset",
+		"ODD draws differ from a rebuilt dataset",
+		"RANGE draws differ from a rebuilt dataset",
+		"residue draws differ from a rebuilt dataset",
+		"predicate draws differ from a rebuilt dataset"
+	};
+	for (std::size_t c = 0; c < sizeof(states) / sizeof(*states); ++c) {
+		const std::vector<int> expected = members(model, states[c]);
+		mixer.setControllerState(states[c]);
+		rebuilt.setControllerState(states[c]);
+		checkPopulation(rebuilt, expected, names[c]);
+		checkPopulation(mixer, expected, names[c]);
+		checkDraws(mixer, expected, names[c]);
+	}
+}
+// DESCRIPTION:
+// * Applies "length" random appends, removes and updates to "mixer", which
+// holds the values of "model", and checks every controller's values against
+// a numMixer built from scratch over the resulting values.
+
+
+void testSequence(std::mt19937& eng, bool borrowed, std::size_t length)
+{
+	std::uniform_int_distribution<int> valueDistr(LOW_VALUE, HIGH_VALUE);
+	std::vector<int> initial(INITIAL_SIZE);
+	for (std::size_t i = 0; i < initial.size(); ++i) {
+		initial[i] = valueDistr(eng);
+	}
+	if (borrowed) {
+		numMixer mixer(initial.data(), initial.size());
+		mutateAndCheck(mixer, initial, eng, length);
+	} else {
+		std::vector<int> values = initial;
+		numMixer mixer(values);
+		mutateAndCheck(mixer, initial, eng, length);
+	}
+}
+// DESCRIPTION:
+// * Runs a sequence of "length" mutations over random values, owned by the
+// numMixer or "borrowed" from the caller.
\ No newline at end of file
@@ -0,0 +1,206 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: pingUniqueTest.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Checks numMixer::pingUnique(): draws are distinct dataset elements of
+// the controller's parity, a ping of the whole population is a permutation
+// of it, and asking for more values than are eligible fails cleanly,
+// leaving the values and the countdown untouched.
+// * Checks that the sparse Fisher-Yates shuffle is uniform (chi-square
+// tests): the first value over the population, the ordered pair of the
+// first two values, and how often each element is included.
+// * Prints every failing check and returns 1 if any failed, 0 otherwise.
+
+// ASSUMPTIONS:
+// * Mixers are seeded with fixed values, so results are reproducible.
+// * Successive pings of a mixer are independent, so every ping is one trial.
+// * Inclusions within a ping are negatively correlated (drawn without
+// replacement), which only makes their chi-square test more lenient.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <algorithm>  // adjacent_find, sort
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+#include "testUtil.h"
+
+
+const std::size_t POPULATION = 16;
+// Dataset size of the uniformity checks.
+
+const std::size_t PICKS = 4;
+// Values per ping in the uniformity checks.
+
+const std::size_t TRIALS = 40000;
+// Pings per uniformity check.
+
+const std::size_t PINGS_PER_MIXER = 10;
+// Pings every mixer can serve: the least a countdown allows.
+
+
+int failures = 0;
+// The number of failed checks so far.
+
+
+void check(bool passed, const char* what);
+
+void testDistinct();
+
+void testExhausted();
+
+void testUniformity();
+
+
+int main()
+{
+	testDistinct();
+	testExhausted();
+	testUniformity();
+
+	if (failures == 0) {
+		std::printf("pingUniqueTest: all checks passed\n");
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+
+void check(bool passed, const char* what)
+{
+	if (!passed) {
+		std::printf("pingUniqueTest: %s\n", what);
+		++failures;
+	}
+}
+// DESCRIPTION:
+// * Prints "what" and counts a failure unless "passed".
+
+
+void testDistinct()
+{
+	const int SIZE = 100000;
+	std::vector<int> dataset(SIZE);
+	for (int i = 0; i < SIZE; ++i) {
+		dataset[i] = i;
+	}
+	numMixer mixer(dataset);
+	mixer.seed(1);
+
+	// sparse: a few values of a large population
+	std::vector<int> values(1000);
+	check(mixer.pingUnique(values), "a sparse unique ping failed");
+	std::sort(values.begin(), values.end());
+	check(std::adjacent_find(values.begin(), values.end()) == values.end()
+	      && values.front() >= 0 && values.back() < SIZE,
+	      "a sparse unique ping repeated an element or left the dataset");
+
+	// the whole of one parity: a permutation of it
+	mixer.setControllerState(numMixer::ODD);
+	values.assign(SIZE / 2, 0);
+	check(mixer.pingUnique(values), "a unique ping of every odd value failed");
+	std::sort(values.begin(), values.end());
+	bool permutation = true;
+	for (int i = 0; i < SIZE / 2; ++i) {
+		permutation = permutation && values[i] == 2 * i + 1;
+	}
+	check(permutation, "a unique ping of every odd value is no permutation");
+
+	mixer.setControllerState(numMixer::EVEN);
+	values.assign(5000, 1);
+	bool even = mixer.pingUnique(values);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		even = even && values[i] % 2 == 0;
+	}
+	check(even, "an EVEN unique ping failed or returned an odd value");
+}
+// DESCRIPTION:
+// * Checks distinctness and parity over a dataset of 0 to 99999.
+
+
+void testExhausted()
+{
+	std::vector<int> dataset = {1, 2, 3, 4, 5, 6, 7};
+	numMixer mixer(dataset);
+
+	// more values than eligible: fails without writing or counting down
+	std::vector<int> values(8, -1);
+	bool untouched = true;
+	for (int attempt = 0; attempt < 30; ++attempt) {
+		untouched = untouched && !mixer.pingUnique(values);
+	}
+	mixer.setControllerState(numMixer::EVEN);
+	values.assign(4, -1);
+	untouched = untouched && !mixer.pingUnique(values);
+	mixer.setControllerState(numMixer::WEIGHTED);
+	values.assign(1, -1);
+	untouched = untouched && !mixer.pingUnique(values);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		untouched = untouched && values[i] == -1;
+	}
+	check(untouched, "an impossible unique ping succeeded or wrote values");
+
+	// every failed ping above left the countdown alone
+	mixer.setControllerState(numMixer::EVEN);
+	values.assign(3, 0);
+	int succeeded = 0;
+	while (mixer.pingUnique(values)) {
+		++succeeded;
+	}
+	check(succeeded >= 10 && succeeded <= 20,
+	      "failed unique pings consumed the countdown");
+}
+// DESCRIPTION:
+// * Asks for more values than the dataset or parity holds, and for WEIGHTED
+// values, then checks the countdown still allows 10-20 pings.
+
+
+void testUniformity()
+{
+	std::vector<int> dataset(POPULATION);
+	for (std::size_t i = 0; i < POPULATION; ++i) {
+		dataset[i] = static_cast<int>(i);
+	}
+
+	std::vector<std::size_t> first(POPULATION, 0);
+	std::vector<std::size_t> pairs(POPULATION * POPULATION, 0);
+	std::vector<std::size_t> included(POPULATION, 0);
+	std::vector<int> values(PICKS);
+	bool pinged = true;
+	for (std::size_t m = 0; m < TRIALS / PINGS_PER_MIXER; ++m) {
+		numMixer mixer(dataset);
+		mixer.seed(m);
+		for (std::size_t p = 0; p < PINGS_PER_MIXER; ++p) {
+			pinged = pinged && mixer.pingUnique(values);
+			++first[values[0]];
+			++pairs[values[0] * POPULATION + values[1]];
+			for (std::size_t k = 0; k < PICKS; ++k) {
+				++included[values[k]];
+			}
+		}
+	}
+
+	// ordered pairs of distinct elements are equally likely, others never
+	std::vector<double> pairExpected(POPULATION * POPULATION,
+	                                 static_cast<double>(TRIALS)
+	                                 / (POPULATION * (POPULATION - 1)));
+	for (std::size_t i = 0; i < POPULATION; ++i) {
+		pairExpected[i * POPULATION + i] = 0;
+	}
+	check(pinged, "a unique ping of the uniformity checks failed");
+	check(chiSquarePasses(first, std::vector<double>(POPULATION,
+	      static_cast<double>(TRIALS) / POPULATION)),
+	      "the first unique value is not uniform");
+	check(chiSquarePasses(pairs, pairExpected),
+	      "the first two unique values are not a uniform ordered pair");
+	check(chiSquarePasses(included, std::vector<double>(POPULATION,
+	      static_cast<double>(TRIALS) * PICKS / POPULATION)),
+	      "elements are not included equally often");
+}
+// DESCRIPTION:
+// * Pings PICKS unique values TRIALS times from 0 to POPULATION - 1 and tests
+// the first value, the first two and the inclusions for uniformity.
\ No newline at end of file
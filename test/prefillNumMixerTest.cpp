@@ -0,0 +1,169 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: prefillNumMixerTest.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Checks prefillNumMixer's underrun counters: a ping larger than a ring
+// counts an underrun for its controller class only, while pings served from
+// a full ring count none.
+// * Checks that a ping draining a ring wakes the producer, which refills it
+// well before the deadline, and that every value respects the controller.
+// * Prints every failing check and returns 1 if any failed, 0 otherwise.
+
+// ASSUMPTIONS:
+// * The dataset is 1-100 and rings hold 16 values. Every mixer starts with
+// at least 10 pings, more than any check needs.
+// * Waits for the producer give up after DEADLINE, far longer than a refill
+// of 16 values takes.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <chrono>  // steady_clock, seconds
+#include <thread>  // this_thread
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+#include "../include/prefillNumMixer.h"
+
+
+const std::size_t RING_SIZE = 16;
+// Values buffered per controller class.
+
+const std::chrono::seconds DEADLINE(5);
+// How long a wait for the producer may take.
+
+
+int failures = 0;
+// The number of failed checks so far.
+
+
+void check(bool passed, const char* what);
+
+bool waitFull(const prefillNumMixer& mixer,
+              numMixerTypes::OutputController state);
+
+bool respects(const std::vector<int>& values,
+              numMixerTypes::OutputController state);
+
+void testOversizedPings();
+
+void testRefill();
+
+
+int main()
+{
+	testOversizedPings();
+	testRefill();
+
+	if (failures == 0) {
+		std::printf("prefillNumMixerTest: all checks passed\n");
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+
+void check(bool passed, const char* what)
+{
+	if (!passed) {
+		std::printf("prefillNumMixerTest: %s\n", what);
+		++failures;
+	}
+}
+// DESCRIPTION:
+// * Prints "what" and counts a failure unless "passed".
+
+
+bool waitFull(const prefillNumMixer& mixer,
+              numMixerTypes::OutputController state)
+{
+	const std::chrono::steady_clock::time_point start =
+		std::chrono::steady_clock::now();
+	while (mixer.buffered(state) < mixer.bufferSize()) {
+		if (std::chrono::steady_clock::now() - start > DEADLINE) {
+			return false;
+		}
+		std::this_thread::yield();
+	}
+	return true;
+}
+// DESCRIPTION:
+// * Waits until the ring of "state" is full and returns whether it filled
+// before DEADLINE.
+
+
+bool respects(const std::vector<int>& values,
+              numMixerTypes::OutputController state)
+{
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		const int value = values[i];
+		if (value < 1 || value > 100
+		    || (state == numMixerTypes::EVEN && value % 2 != 0)
+		    || (state == numMixerTypes::ODD && value % 2 == 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+// DESCRIPTION:
+// * Returns whether every value is in 1-100 and of the parity of "state".
+
+
+void testOversizedPings()
+{
+	prefillNumMixer mixer(RING_SIZE);
+	std::vector<int> values(2 * RING_SIZE);
+
+	check(mixer.ping(values) && respects(values, numMixerTypes::MIX),
+	      "an oversized MIX ping failed");
+	check(mixer.underrunCount(numMixerTypes::MIX) == 1,
+	      "an oversized MIX ping did not count an underrun");
+
+	mixer.setControllerState(numMixerTypes::EVEN);
+	check(mixer.ping(values) && respects(values, numMixerTypes::EVEN),
+	      "an oversized EVEN ping failed or returned odd values");
+	check(mixer.underrunCount(numMixerTypes::EVEN) == 1,
+	      "an oversized EVEN ping did not count an underrun");
+	check(mixer.underrunCount(numMixerTypes::MIX) == 1
+	      && mixer.underrunCount(numMixerTypes::ODD) == 0,
+	      "an underrun was counted for another class");
+	check(mixer.underrunCount() == 2,
+	      "the total does not sum the underruns of every class");
+
+	// a ping the ring can serve counts nothing
+	mixer.setControllerState(numMixerTypes::ODD);
+	values.resize(RING_SIZE);
+	check(waitFull(mixer, numMixerTypes::ODD),
+	      "the producer did not fill the ODD ring");
+	check(mixer.ping(values) && respects(values, numMixerTypes::ODD),
+	      "a buffered ODD ping failed or returned even values");
+	check(mixer.underrunCount() == 2,
+	      "a ping served from a full ring counted an underrun");
+}
+// DESCRIPTION:
+// * Pings more values than a ring holds, which always underruns, then as
+// many as a full ring holds, which never does.
+
+
+void testRefill()
+{
+	prefillNumMixer mixer(RING_SIZE);
+	std::vector<int> values(RING_SIZE);
+
+	check(waitFull(mixer, numMixerTypes::MIX),
+	      "the producer did not fill the MIX ring");
+	for (int round = 0; round < 5; ++round) {
+		check(mixer.ping(values) && respects(values, numMixerTypes::MIX),
+		      "a buffered MIX ping failed");
+		check(waitFull(mixer, numMixerTypes::MIX),
+		      "draining a ring did not wake the producer to refill it");
+	}
+	check(mixer.underrunCount() == 0,
+	      "pings served from refilled rings counted underruns");
+}
+// DESCRIPTION:
+// * Drains the MIX ring five times, each time waiting for the producer to
+// refill it: a lost wakeup leaves the ring empty past DEADLINE.
\ No newline at end of file
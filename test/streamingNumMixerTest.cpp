@@ -0,0 +1,233 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: streamingNumMixerTest.cpp
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Checks that streamingNumMixer's reservoirs are uniform samples of a known
+// stream: over many independently seeded mixers fed the values 0 to
+// STREAM_SIZE - 1, a value pinged from the MIX, EVEN or ODD reservoir must be
+// uniform over the stream's values of that class (chi-square test by value
+// range). The stream is offered in blocks much longer than a reservoir, so
+// MIX jumps over most of each block and between blocks.
+// * Checks that EVEN and ODD pings only return values of their parity.
+// * Checks that a stream ingested on the background thread is consumed whole,
+// and that a read that throws ends the ingestion and is surfaced through
+// error() instead of terminating the program.
+// * Prints every failing check and returns 1 if any failed, 0 otherwise.
+
+// ASSUMPTIONS:
+// * Mixers are seeded with fixed values, so results are reproducible.
+// * One value is pinged per class and mixer: values pinged from the same
+// reservoir are correlated, which would inflate the statistic.
+
+
+#include <cstddef>  // size_t
+#include <cstdio>  // printf
+#include <exception>  // exception, rethrow_exception
+#include <istream>  // istream
+#include <sstream>  // istringstream
+#include <stdexcept>  // runtime_error
+#include <streambuf>  // streambuf
+#include <string>  // string
+#include <thread>  // this_thread
+#include <vector>  // vector
+
+
+#include "../include/numMixer.h"
+#include "../include/streamingNumMixer.h"
+#include "testUtil.h"
+
+
+const std::size_t STREAM_SIZE = 4096;
+// Values in the test stream, 0 to STREAM_SIZE - 1.
+
+const std::size_t BLOCK_SIZE = 1000;
+// Values per offer() call.
+
+const std::size_t CAPACITY = 16;
+// Values per reservoir.
+
+const std::size_t MIXERS = 20000;
+// Independently seeded mixers per uniformity check.
+
+const std::size_t BUCKETS = 64;
+// Value ranges counted by the chi-square test.
+
+
+int failures = 0;
+// The number of failed checks so far.
+
+
+class throwingBuffer : public std::streambuf
+{
+	protected:
+		int_type underflow() override;
+		// DESCRIPTION:
+		// * Throws, like a source whose read fails.
+};
+
+
+void check(bool passed, const char* what);
+
+void testUniformity();
+
+void testIngest();
+
+void testThrowingStream();
+
+void waitIdle(const streamingNumMixer& mixer);
+
+
+int main()
+{
+	testUniformity();
+	testIngest();
+	testThrowingStream();
+
+	if (failures == 0) {
+		std::printf("streamingNumMixerTest: all checks passed\n");
+	}
+	return (failures == 0) ? 0 : 1;
+}
+
+
+std::streambuf::int_type throwingBuffer::underflow()
+{
+	throw std::runtime_error("source failed");
+}
+
+
+void check(bool passed, const char* what)
+{
+	if (!passed) {
+		std::printf("streamingNumMixerTest: %s\n", what);
+		++failures;
+	}
+}
+// DESCRIPTION:
+// * Prints "what" and counts a failure unless "passed".
+
+
+void testUniformity()
+{
+	const numMixerTypes::OutputController STATES[] = {
+		numMixerTypes::MIX, numMixerTypes::EVEN, numMixerTypes::ODD
+	};
+	std::vector<int> stream(STREAM_SIZE);
+	for (std::size_t i = 0; i < STREAM_SIZE; ++i) {
+		stream[i] = static_cast<int>(i);
+	}
+
+	std::vector<std::size_t> observed[3];
+	for (int c = 0; c < 3; ++c) {
+		observed[c].assign(BUCKETS, 0);
+	}
+	bool parityKept = true;
+	std::vector<int> value(1);
+	for (std::size_t m = 0; m < MIXERS; ++m) {
+		streamingNumMixer mixer(CAPACITY);
+		mixer.seed(m);
+		for (std::size_t begin = 0; begin < STREAM_SIZE; begin += BLOCK_SIZE) {
+			const std::size_t count = (STREAM_SIZE - begin < BLOCK_SIZE)
+			                          ? STREAM_SIZE - begin : BLOCK_SIZE;
+			mixer.offer(stream.data() + begin, count);
+		}
+		for (int c = 0; c < 3; ++c) {
+			mixer.setControllerState(STATES[c]);
+			if (!mixer.ping(value)) {
+				parityKept = false;
+				continue;
+			}
+			const int v = value[0];
+			parityKept = parityKept
+			             && (STATES[c] != numMixerTypes::EVEN || v % 2 == 0)
+			             && (STATES[c] != numMixerTypes::ODD || v % 2 == 1);
+			++observed[c][v * BUCKETS / STREAM_SIZE];
+		}
+	}
+
+	// every bucket holds as many values of each class
+	const std::vector<double> expected(BUCKETS,
+	                                   static_cast<double>(MIXERS) / BUCKETS);
+	check(parityKept, "a ping failed or returned a value of the wrong parity");
+	check(chiSquarePasses(observed[0], expected),
+	      "the MIX reservoir is not a uniform sample of the stream");
+	check(chiSquarePasses(observed[1], expected),
+	      "the EVEN reservoir is not a uniform sample of the even values");
+	check(chiSquarePasses(observed[2], expected),
+	      "the ODD reservoir is not a uniform sample of the odd values");
+}
+// DESCRIPTION:
+// * Pings one value per class from each of MIXERS mixers fed the test stream,
+// and tests the pinged values for uniformity per class.
+
+
+void testIngest()
+{
+	std::vector<int> stream(STREAM_SIZE);
+	for (std::size_t i = 0; i < STREAM_SIZE; ++i) {
+		stream[i] = static_cast<int>(2 * i + 1);
+	}
+	std::istringstream in(std::string(
+		reinterpret_cast<const char*>(stream.data()),
+		stream.size() * sizeof(int)));
+
+	streamingNumMixer mixer(CAPACITY);
+	check(mixer.ingest(in), "ingesting a stream did not start");
+	waitIdle(mixer);
+	check(mixer.seen() == STREAM_SIZE,
+	      "the ingested stream was not consumed whole");
+	check(!mixer.error(), "a stream that ended normally reported an error");
+
+	std::vector<int> values(64);
+	mixer.setControllerState(numMixerTypes::ODD);
+	bool inStream = mixer.ping(values);
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		inStream = inStream && values[i] % 2 == 1
+		           && values[i] < static_cast<int>(2 * STREAM_SIZE);
+	}
+	check(inStream, "an ODD ping of an ingested stream failed");
+	mixer.setControllerState(numMixerTypes::EVEN);
+	check(!mixer.ping(values),
+	      "an EVEN ping succeeded on a stream without even values");
+}
+// DESCRIPTION:
+// * Ingests a stream of odd values from a std::istream on the background
+// thread and checks what the mixer saw and returns.
+
+
+void testThrowingStream()
+{
+	throwingBuffer buffer;
+	std::istream in(&buffer);
+	in.exceptions(std::ios_base::badbit);
+
+	streamingNumMixer mixer(CAPACITY);
+	check(mixer.ingest(in), "ingesting a failing stream did not start");
+	waitIdle(mixer);
+	bool surfaced = false;
+	try {
+		if (mixer.error()) {
+			std::rethrow_exception(mixer.error());
+		}
+	} catch (const std::exception&) {
+		surfaced = true;
+	}
+	check(surfaced, "a throwing read was not surfaced through error()");
+	check(mixer.seen() == 0, "a failing stream reported values");
+}
+// DESCRIPTION:
+// * Ingests a stream whose reads throw: the program must survive and the
+// exception must be available from error().
+
+
+void waitIdle(const streamingNumMixer& mixer)
+{
+	while (mixer.ingesting()) {
+		std::this_thread::yield();
+	}
+}
+// DESCRIPTION:
+// * Waits until "mixer" has finished ingesting.
\ No newline at end of file
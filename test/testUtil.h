@@ -0,0 +1,64 @@
+// AUTHOR: Ryan McKenzie
+// FILENAME: testUtil.h
+// DATE: October 18, 2026
+// REVISION HISTORY: v1.0.0
+// PLATFORM: GCC v6.3.0
+
+// DESCRIPTION:
+// * Header-only helpers shared by the tests in test/: the chi-square limit
+// statistical checks are held to, and a chi-square statistic over counts.
+
+// ASSUMPTIONS:
+// * Each test is its own program (see compileproject.ps1), seeded with fixed
+// values, so a passing build keeps passing.
+// * Statistical checks fail when their statistic exceeds the 1 - 10^-4
+// quantile of the chi-square distribution: a correct implementation fails a
+// given check with probability 10^-4.
+
+
+#ifndef testUtil_INCLUDED
+#define testUtil_INCLUDED
+
+
+#include <cmath>  // sqrt
+#include <cstddef>  // size_t
+#include <vector>  // vector
+
+
+inline double chiSquareLimit(std::size_t degrees)
+{
+	const double Z = 3.719;  // the 1 - 10^-4 quantile of the normal
+	const double k = static_cast<double>(degrees);
+	const double root = 1 - 2 / (9 * k) + Z * std::sqrt(2 / (9 * k));
+	return k * root * root * root;
+}
+// DESCRIPTION:
+// * Returns the 1 - 10^-4 quantile of the chi-square distribution with
+// "degrees" degrees of freedom (Wilson-Hilferty approximation).
+
+
+inline bool chiSquarePasses(const std::vector<std::size_t>& observed,
+                            const std::vector<double>& expected)
+{
+	double statistic = 0;
+	std::size_t degrees = 0;
+	for (std::size_t b = 0; b < observed.size(); ++b) {
+		if (expected[b] == 0) {
+			if (observed[b] != 0) {
+				return false;
+			}
+			continue;
+		}
+		const double difference = observed[b] - expected[b];
+		statistic += difference * difference / expected[b];
+		++degrees;
+	}
+	return (degrees < 2) || (statistic <= chiSquareLimit(degrees - 1));
+}
+// DESCRIPTION:
+// * Returns whether the "observed" counts fit the "expected" ones within the
+// chi-square limit. Buckets expected to stay empty must stay empty, and do
+// not count as degrees of freedom.
+
+
+#endif
\ No newline at end of file